@@ -0,0 +1,133 @@
+/*
+ * This file is part of eSolid.
+ *
+ * Copyright (C) 2010 - 2013 Nenad Radulovic
+ *
+ * eSolid is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * eSolid is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with eSolid.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * web site:    http://github.com/nradulovic
+ * e-mail  :    nenad.b.radulovic@gmail.com
+ *//***********************************************************************//**
+ * @file
+ * @author      Nenad Radulovic
+ * @brief       Memory allocator interface header
+ * @defgroup    base_allocator Memory allocator interface
+ * @brief       Memory allocator interface
+ *********************************************************************//** @{ */
+/**@defgroup    base_allocator_intf Interface
+ * @brief       Memory allocator interface API
+ * @details     Modules which need to allocate memory at run time take a
+ *              pointer to allocator structure instead of calling a particular
+ *              allocator. The application connects the structure to a heap,
+ *              a memory pool or to standard library functions.
+ *
+ *              Example which uses standard library:
+ * @code
+ *              static void * appAlloc(void * context, size_t size) {
+ *                  (void)context;
+ *
+ *                  return (malloc(size));
+ *              }
+ *
+ *              static void appFree(void * context, void * mem, size_t size) {
+ *                  (void)context;
+ *                  (void)size;
+ *                  free(mem);
+ *              }
+ *
+ *              static const struct esAllocator AppAllocator = {
+ *                  appAlloc,
+ *                  appFree,
+ *                  NULL
+ *              };
+ * @endcode
+ * @{ *//*--------------------------------------------------------------------*/
+
+#ifndef ES_ALLOCATOR_H_
+#define ES_ALLOCATOR_H_
+
+/*=========================================================  INCLUDE FILES  ==*/
+
+#include <stddef.h>
+
+#include "plat/compiler.h"
+
+/*===============================================================  MACRO's  ==*/
+/*------------------------------------------------------  C++ extern begin  --*/
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*============================================================  DATA TYPES  ==*/
+
+/**@brief       Memory allocator
+ * @api
+ */
+struct esAllocator {
+    void *           (* alloc)(void * context, size_t size);                    /**<@brief Allocate memory, return NULL on failure          */
+    void             (* free)(void * context, void * mem, size_t size);         /**<@brief Free memory allocated by alloc                   */
+    void *              context;                                                /**<@brief Allocator private data                           */
+};
+
+/**@brief       Memory allocator type
+ * @api
+ */
+typedef struct esAllocator esAllocator;
+
+/*======================================================  GLOBAL VARIABLES  ==*/
+/*===================================================  FUNCTION PROTOTYPES  ==*/
+
+/**@brief       Allocate memory
+ * @param       allocator
+ *              Pointer to allocator
+ * @param       size
+ *              Size of memory block in bytes
+ * @return      Pointer to memory block
+ *  @retval     NULL - there is not enough memory
+ * @api
+ */
+static PORT_C_INLINE void * esAllocatorAlloc(
+    const struct esAllocator * allocator,
+    size_t              size) {
+
+    return (allocator->alloc(allocator->context, size));
+}
+
+/**@brief       Free memory
+ * @param       allocator
+ *              Pointer to allocator which has allocated the block
+ * @param       mem
+ *              Pointer to memory block
+ * @param       size
+ *              Size of memory block, the same as given to @ref esAllocatorAlloc
+ * @api
+ */
+static PORT_C_INLINE void esAllocatorFree(
+    const struct esAllocator * allocator,
+    void *              mem,
+    size_t              size) {
+
+    allocator->free(allocator->context, mem, size);
+}
+
+/*--------------------------------------------------------  C++ extern end  --*/
+#ifdef __cplusplus
+}
+#endif
+
+/*================================*//** @cond *//*==  CONFIGURATION ERRORS  ==*/
+/** @endcond *//** @} *//** @} *//*********************************************
+ * END of allocator.h
+ ******************************************************************************/
+#endif /* ES_ALLOCATOR_H_ */
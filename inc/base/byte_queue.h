@@ -0,0 +1,212 @@
+/*
+ * This file is part of eSolid.
+ *
+ * Copyright (C) 2010 - 2013 Nenad Radulovic
+ *
+ * eSolid is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * eSolid is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with eSolid.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * web site:    http://github.com/nradulovic
+ * e-mail  :    nenad.b.radulovic@gmail.com
+ *//***********************************************************************//**
+ * @file
+ * @author      Nenad Radulovic
+ * @brief       Byte record queue header
+ * @defgroup    base_byte_queue Byte record queue
+ * @brief       Byte record queue
+ *********************************************************************//** @{ */
+/**@defgroup    base_byte_queue_intf Interface
+ * @brief       Byte record queue API
+ * @details     Byte record queue stores variable length records directly in
+ *              the queue buffer. Producer reserves space for a record, writes
+ *              it in place and then commits it. Consumer peeks at the oldest
+ *              record, parses it in place and then releases it. A record is
+ *              always contiguous in memory: when a record does not fit before
+ *              the end of buffer the remaining space is skipped and the record
+ *              is placed at the beginning of the buffer.
+ * @{ *//*--------------------------------------------------------------------*/
+
+#ifndef ES_BYTE_QUEUE_H_
+#define ES_BYTE_QUEUE_H_
+
+/*=========================================================  INCLUDE FILES  ==*/
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stddef.h>
+
+#include "plat/compiler.h"
+#include "base/debug.h"
+#include "base/bitop.h"
+
+/*===============================================================  MACRO's  ==*/
+
+/**@brief       Alignment of records in the queue buffer
+ */
+#define ES_QB_ALIGNMENT                 ES_CPU_DEF_DATA_ALIGNMENT
+
+/**@brief       Calculate the buffer space occupied by one record
+ * @param       length
+ *              Length of record data in bytes
+ * @details     Use this macro to calculate the size of the queue buffer.
+ * @api
+ */
+#define ES_QB_SIZEOF(length)                                                    \
+    (ES_ALIGN_UP(sizeof(uint32_t), ES_QB_ALIGNMENT) +                           \
+     ES_ALIGN_UP((length), ES_QB_ALIGNMENT))
+
+/*------------------------------------------------------  C++ extern begin  --*/
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*============================================================  DATA TYPES  ==*/
+
+/**@brief       Byte record queue
+ * @api
+ */
+struct esQb {
+    uint8_t *           buff;                                                   /**<@brief Queue buffer                                     */
+    uint32_t            head;                                                   /**<@brief Write position                                   */
+    uint32_t            tail;                                                   /**<@brief Read position                                    */
+    uint32_t            free;                                                   /**<@brief Number of free bytes                             */
+    uint32_t            size;                                                   /**<@brief Size of buffer in bytes                          */
+    uint32_t            reserved;                                               /**<@brief Bytes taken by pending reservation               */
+    bool                isMirrored;                                             /**<@brief Buffer is mapped twice, back to back             */
+#if   (1 == CONFIG_API_VALIDATION) || defined(__DOXYGEN__)
+    esAtomic            signature;                                              /**<@brief Byte queue structure signature.                  */
+#endif
+};
+
+/**@brief       Byte record queue type
+ * @api
+ */
+typedef struct esQb esQb;
+
+/*======================================================  GLOBAL VARIABLES  ==*/
+/*===================================================  FUNCTION PROTOTYPES  ==*/
+
+/**@brief       Initialize byte record queue
+ * @param       qb
+ *              Pointer to byte record queue
+ * @param       buff
+ *              Queue buffer, aligned to @ref ES_QB_ALIGNMENT
+ * @param       size
+ *              Size of the buffer in bytes, multiple of @ref ES_QB_ALIGNMENT
+ * @api
+ */
+void esQbInit(
+    struct esQb *       qb,
+    void *              buff,
+    size_t              size);
+
+/**@brief       Initialize byte record queue over a mirrored buffer
+ * @param       qb
+ *              Pointer to byte record queue
+ * @param       buff
+ *              Queue buffer which is mapped twice, back to back, in virtual
+ *              memory. Accessing @c buff[size + n] must access @c buff[n].
+ * @param       size
+ *              Size of one mapping in bytes, multiple of @ref ES_QB_ALIGNMENT
+ * @details     Since the buffer wraps around in virtual memory, records are
+ *              never moved to the beginning of buffer and no space is skipped
+ *              at the end of buffer. A record may cross the end of buffer and
+ *              it is still contiguous.
+ * @api
+ */
+void esQbInitMirrored(
+    struct esQb *       qb,
+    void *              buff,
+    size_t              size);
+
+void esQbTerm(
+    struct esQb *       qb);
+
+/**@brief       Reserve space for a record
+ * @param       qb
+ *              Pointer to byte record queue
+ * @param       length
+ *              Length of record data in bytes
+ * @return      Pointer to record data where producer should write the record
+ *  @retval     NULL - there is not enough contiguous space in the queue
+ * @details     The record is not visible to consumer until it is committed
+ *              by @ref esQbCommit. Only one reservation may be pending.
+ * @api
+ */
+void * esQbReserve(
+    struct esQb *       qb,
+    size_t              length);
+
+/**@brief       Commit previously reserved record
+ * @param       qb
+ *              Pointer to byte record queue
+ * @api
+ */
+void esQbCommit(
+    struct esQb *       qb);
+
+/**@brief       Peek at the oldest record in the queue
+ * @param       qb
+ *              Pointer to byte record queue
+ * @param       length
+ *              Pointer to variable which will receive the record length
+ * @return      Pointer to record data
+ *  @retval     NULL - the queue is empty
+ * @api
+ */
+void * esQbPeek(
+    const struct esQb * qb,
+    size_t *            length);
+
+/**@brief       Release the oldest record in the queue
+ * @param       qb
+ *              Pointer to byte record queue
+ * @api
+ */
+void esQbRelease(
+    struct esQb *       qb);
+
+static PORT_C_INLINE size_t esQbSize(
+    const struct esQb * qb) {
+
+    return ((size_t)(qb->size));
+}
+
+static PORT_C_INLINE size_t esQbFreeSpace(
+    const struct esQb * qb) {
+
+    return ((size_t)(qb->free));
+}
+
+static PORT_C_INLINE bool esQbIsEmpty(
+    const struct esQb * qb) {
+
+    if (qb->free == qb->size) {
+
+        return (true);
+    } else {
+
+        return (false);
+    }
+}
+
+/*--------------------------------------------------------  C++ extern end  --*/
+#ifdef __cplusplus
+}
+#endif
+
+/*================================*//** @cond *//*==  CONFIGURATION ERRORS  ==*/
+/** @endcond *//** @} *//** @} *//*********************************************
+ * END of byte_queue.h
+ ******************************************************************************/
+#endif /* ES_BYTE_QUEUE_H_ */
@@ -55,6 +55,7 @@
     entry(ES_ERROR_NOT_PERMITTED,       1001u,  "operation not permitted")      \
     entry(ES_ERROR_NOT_ENABLED,         1002u,  "operation not enabled")        \
     entry(ES_ERROR_NOT_FOUND,           1002u,  "item not found")               \
+    entry(ES_ERROR_TIMEOUT,             1003u,  "operation timed out")          \
     entry(ES_ERROR_ARG_INVALID,         2000u,  "argument is invalid")          \
     entry(ES_ERROR_ARG_OUT_OF_RANGE,    2001u,  "argument is out of range")     \
     entry(ES_ERROR_ARG_NULL,            2002u,  "argument is null")
@@ -0,0 +1,245 @@
+/*
+ * This file is part of eSolid.
+ *
+ * Copyright (C) 2010 - 2013 Nenad Radulovic
+ *
+ * eSolid is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * eSolid is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with eSolid.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * web site:    http://github.com/nradulovic
+ * e-mail  :    nenad.b.radulovic@gmail.com
+ *//***********************************************************************//**
+ * @file
+ * @author      Nenad Radulovic
+ * @brief       Hash table header
+ * @defgroup    base_hash_table Hash table
+ * @brief       Hash table
+ *********************************************************************//** @{ */
+/**@defgroup    base_hash_table_intf Interface
+ * @brief       Hash table API
+ * @details     Intrusive hash table with chained buckets. Hash table nodes are
+ *              embedded in the user structures and each bucket is an
+ *              @ref esDls list, so a node is removed in constant time. The
+ *              caller supplies a hash function of the key and a function which
+ *              compares a node with a key.
+ *
+ *              When the number of nodes reaches the number of buckets, a new
+ *              bucket array of double size is allocated and the nodes are
+ *              moved to it incrementally: every insert and remove moves
+ *              @ref CONFIG_HT_MIGRATE_STEP buckets of the old array. Until all
+ *              buckets are moved, lookups search both arrays. This way no
+ *              single operation has to rehash the whole table.
+ * @{ *//*--------------------------------------------------------------------*/
+
+#ifndef ES_HASH_TABLE_H_
+#define ES_HASH_TABLE_H_
+
+/*=========================================================  INCLUDE FILES  ==*/
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stddef.h>
+
+#include "plat/compiler.h"
+#include "base/debug.h"
+#include "base/error.h"
+#include "base/list.h"
+#include "base/allocator.h"
+
+/*===============================================================  MACRO's  ==*/
+
+/**@brief       Get the entry node pointer
+ * @param       typeOfNode
+ *              Type of node entry
+ * @param       table
+ *              Name of hash table node member in the entry
+ * @param       node
+ *              Pointer to the hash table node
+ * @api
+ */
+#define ES_HT_NODE_ENTRY(typeOfNode, table, node)                               \
+    ((typeOfNode *)((char *)(node) - offsetof(typeOfNode, table)))
+
+/*==============================================================  SETTINGS  ==*/
+
+/**@brief       Number of old buckets moved by one insert or remove during
+ *              resize
+ * @details     The value must be at least 2, so the resize finishes before the
+ *              new bucket array gets full.
+ */
+#if !defined(CONFIG_HT_MIGRATE_STEP)
+# define CONFIG_HT_MIGRATE_STEP         2u
+#endif
+
+/*------------------------------------------------------  C++ extern begin  --*/
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*============================================================  DATA TYPES  ==*/
+
+/**@brief       Hash table node
+ * @api
+ */
+struct esHtNode {
+    struct esDls        list;                                                   /**<@brief Bucket list                                      */
+    uint32_t            hash;                                                   /**<@brief Hash of node key                                 */
+};
+
+/**@brief       Hash table node type
+ * @api
+ */
+typedef struct esHtNode esHtNode;
+
+/**@brief       Hash function
+ * @param       key
+ *              Pointer to key
+ * @return      Hash of the key
+ * @api
+ */
+typedef uint32_t (* esHtHash)(const void * key);
+
+/**@brief       Key compare function
+ * @param       node
+ *              Pointer to node in hash table
+ * @param       key
+ *              Pointer to key
+ * @return      Does the node have the given key?
+ * @api
+ */
+typedef bool (* esHtEqual)(const struct esHtNode * node, const void * key);
+
+/**@brief       Hash table bucket array
+ * @notapi
+ */
+struct esHtBuckets {
+    struct esDls *      bucket;                                                 /**<@brief Bucket list sentinels                            */
+    uint32_t            mask;                                                   /**<@brief Number of buckets minus one                      */
+};
+
+/**@brief       Hash table
+ * @api
+ */
+struct esHt {
+    struct esHtBuckets  table;                                                  /**<@brief Current bucket array                             */
+    struct esHtBuckets  old;                                                    /**<@brief Bucket array being moved, NULL when not resizing */
+    uint32_t            migrate;                                                /**<@brief Next old bucket to move                          */
+    uint32_t            count;                                                  /**<@brief Number of nodes                                  */
+    esHtHash            hash;                                                   /**<@brief Hash function                                    */
+    esHtEqual           equal;                                                  /**<@brief Key compare function                             */
+    const struct esAllocator * allocator;                                       /**<@brief Allocator of bucket arrays                       */
+#if   (1 == CONFIG_API_VALIDATION) || defined(__DOXYGEN__)
+    esAtomic            signature;                                              /**<@brief Hash table structure signature.                  */
+#endif
+};
+
+/**@brief       Hash table type
+ * @api
+ */
+typedef struct esHt esHt;
+
+/*======================================================  GLOBAL VARIABLES  ==*/
+/*===================================================  FUNCTION PROTOTYPES  ==*/
+
+/**@brief       Initialize hash table
+ * @param       ht
+ *              Pointer to hash table
+ * @param       allocator
+ *              Allocator of bucket arrays
+ * @param       hash
+ *              Hash function
+ * @param       equal
+ *              Key compare function
+ * @param       size
+ *              Initial number of buckets, must be a power of two
+ * @return      Operation status
+ *  @retval     ES_ERROR_NONE - the table is initialized
+ *  @retval     ES_ERROR_NO_MEMORY - the bucket array can not be allocated
+ * @api
+ */
+esError esHtInit(
+    struct esHt *       ht,
+    const struct esAllocator * allocator,
+    esHtHash            hash,
+    esHtEqual           equal,
+    size_t              size);
+
+/**@brief       Terminate hash table and free bucket arrays
+ * @details     Nodes which are still in the table are not touched.
+ * @api
+ */
+void esHtTerm(
+    struct esHt *       ht);
+
+/**@brief       Insert a node into hash table
+ * @param       ht
+ *              Pointer to hash table
+ * @param       node
+ *              Node to insert, it must not be in a table
+ * @param       key
+ *              Key of the node
+ * @details     The table does not check for duplicate keys. When a bigger
+ *              bucket array can not be allocated, the node is still inserted
+ *              and the table grows later.
+ * @api
+ */
+void esHtInsert(
+    struct esHt *       ht,
+    struct esHtNode *   node,
+    const void *        key);
+
+/**@brief       Remove a node from hash table
+ * @param       ht
+ *              Pointer to hash table
+ * @param       node
+ *              Node to remove, it must be in this table
+ * @api
+ */
+void esHtRemove(
+    struct esHt *       ht,
+    struct esHtNode *   node);
+
+/**@brief       Find a node by key
+ * @param       ht
+ *              Pointer to hash table
+ * @param       key
+ *              Key to find
+ * @return      Pointer to node with the given key
+ *  @retval     NULL - there is no node with the key
+ * @api
+ */
+struct esHtNode * esHtFind(
+    const struct esHt * ht,
+    const void *        key);
+
+static PORT_C_INLINE size_t esHtCount(
+    const struct esHt * ht) {
+
+    return ((size_t)ht->count);
+}
+
+/*--------------------------------------------------------  C++ extern end  --*/
+#ifdef __cplusplus
+}
+#endif
+
+/*================================*//** @cond *//*==  CONFIGURATION ERRORS  ==*/
+
+#if (CONFIG_HT_MIGRATE_STEP < 2u)
+# error "eSolid RT Kernel: Configuration option CONFIG_HT_MIGRATE_STEP is out of range."
+#endif
+
+/** @endcond *//** @} *//** @} *//*********************************************
+ * END of hash_table.h
+ ******************************************************************************/
+#endif /* ES_HASH_TABLE_H_ */
@@ -33,11 +33,24 @@
 
 #include <stddef.h>
 #include <stdbool.h>
+#include <stdint.h>
 
 #include "plat/compiler.h"
 
 /*===============================================================  MACRO's  ==*/
 
+/**@brief       Prefetch the node which is @ref PORT_C_PREFETCH_DISTANCE nodes
+ *              ahead of the current node
+ * @param       node
+ *              Pointer to the node which follows the current node
+ * @notapi
+ */
+#if (PORT_C_PREFETCH_DISTANCE == 2u)
+# define ES_LIST_PREFETCH_(node)        PORT_C_PREFETCH((node)->next)
+#else
+# define ES_LIST_PREFETCH_(node)        PORT_C_PREFETCH((node))
+#endif
+
 /*------------------------------------------------------------------------*//**
  * @name        Singly linked list with Sentinel
  * @{ *//*--------------------------------------------------------------------*/
@@ -54,6 +67,46 @@
 #define ES_SLS_NODE_ENTRY(typeOfNode, list, node)                               \
     ((typeOfNode *)((char *)(node) - offsetof(typeOfNode, list)))
 
+/**@brief       Iterate over list nodes
+ * @param       sentinel
+ *              Pointer to list sentinel
+ * @param       node
+ *              Pointer variable which holds the current node in loop body
+ * @param       tmp
+ *              Pointer variable which holds the next node
+ * @details     The next node is taken before the loop body is executed, so
+ *              the body may unlink the current node. While the body handles
+ *              the current node, the node @ref PORT_C_PREFETCH_DISTANCE nodes
+ *              ahead is prefetched.
+ * @api
+ */
+#define ES_SLS_FOR_EACH(sentinel, node, tmp)                                    \
+    for ((node) = (sentinel)->next, (tmp) = (node)->next;                       \
+         ES_LIST_PREFETCH_(tmp), (node) != (sentinel);                          \
+         (node) = (tmp), (tmp) = (node)->next)
+
+/**@brief       Iterate over list entries
+ * @param       typeOfNode
+ *              Type of node entry
+ * @param       list
+ *              Name of list member in the entry
+ * @param       sentinel
+ *              Pointer to list sentinel
+ * @param       entry
+ *              Entry pointer variable which holds the current entry in loop
+ *              body
+ * @param       tmp
+ *              List pointer variable which holds the next node
+ * @details     See @ref ES_SLS_FOR_EACH.
+ * @api
+ */
+#define ES_SLS_FOR_EACH_ENTRY(typeOfNode, list, sentinel, entry, tmp)           \
+    for ((tmp) = (sentinel)->next;                                              \
+         ((tmp) != (sentinel)) &&                                               \
+         ((entry) = ES_SLS_NODE_ENTRY(typeOfNode, list, (tmp)),                 \
+          (tmp) = (tmp)->next, ES_LIST_PREFETCH_(tmp), 1);                      \
+        )
+
 /** @} *//*---------------------------------------------------------------*//**
  * @name        Doubly Linked list with Sentinel
  * @{ *//*--------------------------------------------------------------------*/
@@ -70,6 +123,94 @@
 #define ES_DLS_NODE_ENTRY(typeOfNode, list, node)                               \
     ((typeOfNode *)((char *)(node) - offsetof(typeOfNode, list)))
 
+/**@brief       Iterate over list nodes
+ * @param       sentinel
+ *              Pointer to list sentinel
+ * @param       node
+ *              Pointer variable which holds the current node in loop body
+ * @param       tmp
+ *              Pointer variable which holds the next node
+ * @details     The next node is taken before the loop body is executed, so
+ *              the body may remove the current node with @ref esDlsNodeRm.
+ *              While the body handles the current node, the node
+ *              @ref PORT_C_PREFETCH_DISTANCE nodes ahead is prefetched.
+ * @api
+ */
+#define ES_DLS_FOR_EACH(sentinel, node, tmp)                                    \
+    for ((node) = (sentinel)->next, (tmp) = (node)->next;                       \
+         ES_LIST_PREFETCH_(tmp), (node) != (sentinel);                          \
+         (node) = (tmp), (tmp) = (node)->next)
+
+/**@brief       Iterate over list entries
+ * @param       typeOfNode
+ *              Type of node entry
+ * @param       list
+ *              Name of list member in the entry
+ * @param       sentinel
+ *              Pointer to list sentinel
+ * @param       entry
+ *              Entry pointer variable which holds the current entry in loop
+ *              body
+ * @param       tmp
+ *              List pointer variable which holds the next node
+ * @details     See @ref ES_DLS_FOR_EACH.
+ * @api
+ */
+#define ES_DLS_FOR_EACH_ENTRY(typeOfNode, list, sentinel, entry, tmp)           \
+    for ((tmp) = (sentinel)->next;                                              \
+         ((tmp) != (sentinel)) &&                                               \
+         ((entry) = ES_DLS_NODE_ENTRY(typeOfNode, list, (tmp)),                 \
+          (tmp) = (tmp)->next, ES_LIST_PREFETCH_(tmp), 1);                      \
+        )
+
+/** @} *//*---------------------------------------------------------------*//**
+ * @name        Offset linked lists
+ * @{ *//*--------------------------------------------------------------------*/
+
+/**@brief       Get the pointer to a node from its offset
+ * @param       base
+ *              Base address of the region which holds the nodes
+ * @param       offset
+ *              Node offset in bytes from the region base
+ * @api
+ */
+#define ES_LO_PTR(base, offset)                                                 \
+    ((void *)((char *)(base) + (offset)))
+
+/**@brief       Get the offset of a node
+ * @param       base
+ *              Base address of the region which holds the nodes
+ * @param       node
+ *              Pointer to node
+ * @api
+ */
+#define ES_LO_OFFSET(base, node)                                                \
+    ((uint32_t)((char *)(node) - (char *)(base)))
+
+/**@brief       Get the entry node pointer
+ * @param       typeOfNode
+ *              Type of node entry
+ * @param       list
+ *              Name of list member in the entry
+ * @param       node
+ *              Pointer to the node
+ * @api
+ */
+#define ES_SLO_NODE_ENTRY(typeOfNode, list, node)                               \
+    ((typeOfNode *)((char *)(node) - offsetof(typeOfNode, list)))
+
+/**@brief       Get the entry node pointer
+ * @param       typeOfNode
+ *              Type of node entry
+ * @param       list
+ *              Name of list member in the entry
+ * @param       node
+ *              Pointer to the node
+ * @api
+ */
+#define ES_DLO_NODE_ENTRY(typeOfNode, list, node)                               \
+    ((typeOfNode *)((char *)(node) - offsetof(typeOfNode, list)))
+
 /** @} *//*---------------------------------------------  C++ extern begin  --*/
 #ifdef __cplusplus
 extern "C" {
@@ -91,6 +232,26 @@ struct esSls {
  */
 typedef struct esSls esSls;
 
+/** @} *//*---------------------------------------------------------------*//**
+ * @name        Singly linked queue
+ * @{ *//*--------------------------------------------------------------------*/
+
+/**@brief       Singly linked queue structure
+ * @details     Singly linked list with a pointer to the last node, so nodes
+ *              can be added at the tail and removed from the head in constant
+ *              time. Nodes are ordinary @ref esSls nodes and the last node
+ *              points back to the sentinel. Nodes must be added and removed
+ *              only by esSlq functions, otherwise the tail pointer gets stale.
+ */
+struct esSlq {
+    struct esSls        sentinel;                                               /**< @brief List sentinel, points to the first node         */
+    struct esSls *      tail;                                                   /**< @brief The last node or sentinel when empty            */
+};
+
+/**@brief       Singly linked queue type
+ */
+typedef struct esSlq esSlq;
+
 /** @} *//*---------------------------------------------------------------*//**
  * @name        Doubly Linked list with Sentinel
  * @{ *//*--------------------------------------------------------------------*/
@@ -106,6 +267,46 @@ struct esDls {
  */
 typedef struct esDls esDls;
 
+/**@brief       Doubly linked list node compare function
+ * @return      Negative value when @c node is less than @c other, zero when
+ *              they are equal and positive value otherwise
+ */
+typedef int (* esDlsCompare)(const esDls * node, const esDls * other);
+
+/** @} *//*---------------------------------------------------------------*//**
+ * @name        Offset linked lists
+ * @details     Offset linked lists have the same shape as @ref esSls and
+ *              @ref esDls lists, but nodes are linked by 32-bit byte offsets
+ *              from the base of a memory region instead of pointers. A node
+ *              takes 4 bytes (singly linked) or 8 bytes (doubly linked) on all
+ *              architectures. All nodes of a list, including the sentinel,
+ *              must be in the same region, which must be smaller than 4GB, and
+ *              every function takes the region base as the first argument.
+ *              When nodes are in an array of objects, the base is the array
+ *              start and offsets play the role of array indexes.
+ * @{ *//*--------------------------------------------------------------------*/
+
+/**@brief       Singly offset linked list structure
+ */
+struct esSlo {
+    uint32_t            next;                                                   /**< @brief Offset of next member in linked list            */
+};
+
+/**@brief       Singly offset linked list type
+ */
+typedef struct esSlo esSlo;
+
+/**@brief       Doubly offset linked list structure
+ */
+struct esDlo {
+    uint32_t            next;                                                   /**< @brief Offset of next member in linked list            */
+    uint32_t            prev;                                                   /**< @brief Offset of previous member in linked list        */
+};
+
+/**@brief       Doubly offset linked list type
+ */
+typedef struct esDlo esDlo;
+
 /** @} *//*-------------------------------------------------------------------*/
 
 /*======================================================  GLOBAL VARIABLES  ==*/
@@ -155,17 +356,23 @@ static PORT_C_INLINE void esSlsNodeAddHead(
     sentinel->next = node;
 }
 
+/**@brief       Remove a node from the list
+ * @details     The list is searched for the node predecessor, so this takes
+ *              linear time. Use @ref esSlsNodeRmAfter when the predecessor is
+ *              known, or @ref esSlq when nodes are taken in FIFO order.
+ */
 static PORT_C_INLINE void esSlsNodeRm(
     esSls *             sentinel,
     esSls *             node) {
 
-    struct esSls **     head;
-    head = &sentinel;
+    esSls *             prev;
+
+    prev = sentinel;
 
-    while ((*head)->next != node) {
-        *head = (*head)->next;
+    while (prev->next != node) {
+        prev = prev->next;
     }
-    (*head)->next = node->next;
+    prev->next = node->next;
 }
 
 static PORT_C_INLINE void esSlsNodeRmAfter(
@@ -191,6 +398,106 @@ static PORT_C_INLINE esSls * esSlsGetHead(const esSls * sentinel) {
     return (sentinel->next);
 }
 
+/** @} *//*---------------------------------------------------------------*//**
+ * @name        Singly linked queue
+ * @{ *//*--------------------------------------------------------------------*/
+
+static PORT_C_INLINE void esSlqInit(
+    esSlq *             queue) {
+
+    esSlsSentinelInit(
+        &queue->sentinel);
+    queue->tail = &queue->sentinel;
+}
+
+static PORT_C_INLINE bool esSlqIsEmpty(
+    const esSlq *       queue) {
+
+    if (queue->sentinel.next != &queue->sentinel) {
+
+        return (false);
+    } else {
+
+        return (true);
+    }
+}
+
+static PORT_C_INLINE void esSlqNodeAddTail(
+    esSlq *             queue,
+    esSls *             node) {
+
+    node->next = &queue->sentinel;
+    queue->tail->next = node;
+    queue->tail = node;
+}
+
+static PORT_C_INLINE void esSlqNodeAddHead(
+    esSlq *             queue,
+    esSls *             node) {
+
+    if (queue->tail == &queue->sentinel) {
+        queue->tail = node;
+    }
+    esSlsNodeAddHead(
+        &queue->sentinel,
+        node);
+}
+
+/**@brief       Get the first node in queue
+ * @return      Pointer to the first node, NULL when the queue is empty
+ */
+static PORT_C_INLINE esSls * esSlqGetHead(
+    const esSlq *       queue) {
+
+    if (queue->sentinel.next == &queue->sentinel) {
+
+        return (NULL);
+    }
+
+    return (queue->sentinel.next);
+}
+
+/**@brief       Remove the first node from queue
+ * @return      Pointer to the removed node, NULL when the queue is empty
+ */
+static PORT_C_INLINE esSls * esSlqNodeRmHead(
+    esSlq *             queue) {
+
+    esSls *             node;
+
+    node = queue->sentinel.next;
+
+    if (node == &queue->sentinel) {
+
+        return (NULL);
+    }
+    queue->sentinel.next = node->next;
+
+    if (queue->tail == node) {
+        queue->tail = &queue->sentinel;
+    }
+
+    return (node);
+}
+
+/**@brief       Move all nodes of @c src queue to the tail of @c dst queue
+ * @details     The @c src queue is empty after this call.
+ */
+static PORT_C_INLINE void esSlqConcat(
+    esSlq *             dst,
+    esSlq *             src) {
+
+    if (src->tail == &src->sentinel) {
+
+        return;
+    }
+    dst->tail->next = src->sentinel.next;
+    src->tail->next = &dst->sentinel;
+    dst->tail = src->tail;
+    esSlqInit(
+        src);
+}
+
 /** @} *//*---------------------------------------------------------------*//**
  * @name        Doubly Linked list with Sentinel
  * @{ *//*--------------------------------------------------------------------*/
@@ -279,12 +586,297 @@ static PORT_C_INLINE bool esDlsIsEmpty(
     }
 }
 
+/**@brief       Move a range of nodes before the given node
+ * @param       currNode
+ *              Nodes are moved before this node. When it is a list sentinel the
+ *              nodes are moved to the list tail.
+ * @param       first
+ *              The first node of the range
+ * @param       last
+ *              The last node of the range, it may be the same as @c first
+ * @details     The range may be taken from the same or from another list, but
+ *              it must not contain @c currNode. This takes constant time.
+ */
+static PORT_C_INLINE void esDlsSpliceRange(
+    esDls *             currNode,
+    esDls *             first,
+    esDls *             last) {
+
+    first->prev->next = last->next;
+    last->next->prev = first->prev;
+    first->prev = currNode->prev;
+    last->next = currNode;
+    currNode->prev->next = first;
+    currNode->prev = last;
+}
+
+/**@brief       Move all nodes of a list before the given node
+ * @param       currNode
+ *              Nodes are moved before this node. When it is a list sentinel the
+ *              nodes are moved to the list tail.
+ * @param       sentinel
+ *              Sentinel of the list whose nodes are moved, the list is empty
+ *              after this call
+ */
+static PORT_C_INLINE void esDlsSplice(
+    esDls *             currNode,
+    esDls *             sentinel) {
+
+    if (sentinel->next != sentinel) {
+        esDlsSpliceRange(
+            currNode,
+            sentinel->next,
+            sentinel->prev);
+    }
+}
+
+/**@brief       Sort a list
+ * @param       sentinel
+ *              Sentinel of the list to sort
+ * @param       compare
+ *              Node compare function
+ * @details     Stable bottom-up merge sort which takes O(n log n) time. Nodes
+ *              are relinked in place and no memory is allocated.
+ */
+void esDlsSort(
+    esDls *             sentinel,
+    esDlsCompare        compare);
+
+/** @} *//*---------------------------------------------------------------*//**
+ * @name        Singly offset linked list with Sentinel
+ * @{ *//*--------------------------------------------------------------------*/
+
+static PORT_C_INLINE esSlo * esSloNext(
+    void *              base,
+    const esSlo *       node) {
+
+    return ((esSlo *)ES_LO_PTR(base, node->next));
+}
+
+static PORT_C_INLINE void esSloNodeInit(
+    void *              base,
+    esSlo *             node) {
+
+    node->next = ES_LO_OFFSET(base, node);
+}
+
+static PORT_C_INLINE void esSloSentinelInit(
+    void *              base,
+    esSlo *             sentinel) {
+
+    esSloNodeInit(
+        base,
+        sentinel);
+}
+
+static PORT_C_INLINE void esSloNodeAdd(
+    void *              base,
+    esSlo *             newNode,
+    esSlo *             prevNode,
+    esSlo *             nextNode) {
+
+    newNode->next = ES_LO_OFFSET(base, nextNode);
+    prevNode->next = ES_LO_OFFSET(base, newNode);
+}
+
+static PORT_C_INLINE void esSloNodeAddAfter(
+    void *              base,
+    esSlo *             currNode,
+    esSlo *             node) {
+
+    esSloNodeAdd(
+        base,
+        node,
+        currNode,
+        esSloNext(base, currNode));
+}
+
+static PORT_C_INLINE void esSloNodeAddHead(
+    void *              base,
+    esSlo *             sentinel,
+    esSlo *             node) {
+
+    esSloNodeAddAfter(
+        base,
+        sentinel,
+        node);
+}
+
+/**@brief       Remove a node from the list
+ * @details     The list is searched for the node predecessor, so this takes
+ *              linear time.
+ */
+static PORT_C_INLINE void esSloNodeRm(
+    void *              base,
+    esSlo *             sentinel,
+    esSlo *             node) {
+
+    esSlo *             prev;
+    uint32_t            offset;
+
+    prev   = sentinel;
+    offset = ES_LO_OFFSET(base, node);
+
+    while (prev->next != offset) {
+        prev = esSloNext(base, prev);
+    }
+    prev->next = node->next;
+}
+
+static PORT_C_INLINE void esSloNodeRmAfter(
+    void *              base,
+    esSlo *             node) {
+
+    node->next = esSloNext(base, node)->next;
+}
+
+static PORT_C_INLINE bool esSloIsEmpty(
+    void *              base,
+    const esSlo *       sentinel) {
+
+    if (sentinel->next != ES_LO_OFFSET(base, sentinel)) {
+
+        return (false);
+    } else {
+
+        return (true);
+    }
+}
+
+static PORT_C_INLINE esSlo * esSloGetHead(
+    void *              base,
+    const esSlo *       sentinel) {
+
+    return (esSloNext(base, sentinel));
+}
+
+/** @} *//*---------------------------------------------------------------*//**
+ * @name        Doubly offset linked list with Sentinel
+ * @{ *//*--------------------------------------------------------------------*/
+
+static PORT_C_INLINE esDlo * esDloNext(
+    void *              base,
+    const esDlo *       node) {
+
+    return ((esDlo *)ES_LO_PTR(base, node->next));
+}
+
+static PORT_C_INLINE esDlo * esDloPrev(
+    void *              base,
+    const esDlo *       node) {
+
+    return ((esDlo *)ES_LO_PTR(base, node->prev));
+}
+
+static PORT_C_INLINE void esDloNodeInit(
+    void *              base,
+    esDlo *             node) {
+
+    node->next = ES_LO_OFFSET(base, node);
+    node->prev = node->next;
+}
+
+static PORT_C_INLINE void esDloSentinelInit(
+    void *              base,
+    esDlo *             sentinel) {
+
+    esDloNodeInit(
+        base,
+        sentinel);
+}
+
+static PORT_C_INLINE void esDloNodeAdd(
+    void *              base,
+    esDlo *             newNode,
+    esDlo *             prevNode,
+    esDlo *             nextNode) {
+
+    newNode->next = ES_LO_OFFSET(base, nextNode);
+    newNode->prev = ES_LO_OFFSET(base, prevNode);
+    prevNode->next = ES_LO_OFFSET(base, newNode);
+    nextNode->prev = prevNode->next;
+}
+
+static PORT_C_INLINE void esDloNodeAddHead(
+    void *              base,
+    esDlo *             sentinel,
+    esDlo *             newNode) {
+
+    esDloNodeAdd(
+        base,
+        newNode,
+        sentinel,
+        esDloNext(base, sentinel));
+}
+
+static PORT_C_INLINE void esDloNodeAddTail(
+    void *              base,
+    esDlo *             sentinel,
+    esDlo *             newNode) {
+
+    esDloNodeAdd(
+        base,
+        newNode,
+        esDloPrev(base, sentinel),
+        sentinel);
+}
+
+static PORT_C_INLINE void esDloNodeAddBefore(
+    void *              base,
+    esDlo *             currNode,
+    esDlo *             newNode) {
+
+    esDloNodeAdd(
+        base,
+        newNode,
+        esDloPrev(base, currNode),
+        currNode);
+}
+
+static PORT_C_INLINE void esDloNodeAddAfter(
+    void *              base,
+    esDlo *             currNode,
+    esDlo *             newNode) {
+
+    esDloNodeAdd(
+        base,
+        newNode,
+        currNode,
+        esDloNext(base, currNode));
+}
+
+static PORT_C_INLINE void esDloNodeRm(
+    void *              base,
+    esDlo *             oldNode) {
+
+    esDloNext(base, oldNode)->prev = oldNode->prev;
+    esDloPrev(base, oldNode)->next = oldNode->next;
+}
+
+static PORT_C_INLINE bool esDloIsEmpty(
+    void *              base,
+    const esDlo *       sentinel) {
+
+    if (sentinel->next != ES_LO_OFFSET(base, sentinel)) {
+
+        return (false);
+    } else {
+
+        return (true);
+    }
+}
+
 /** @} *//*-----------------------------------------------  C++ extern end  --*/
 #ifdef __cplusplus
 }
 #endif
 
 /*================================*//** @cond *//*==  CONFIGURATION ERRORS  ==*/
+
+#if ((PORT_C_PREFETCH_DISTANCE != 1u) && (PORT_C_PREFETCH_DISTANCE != 2u))
+# error "eSolid RT Kernel: Port option PORT_C_PREFETCH_DISTANCE is out of range."
+#endif
+
 /** @endcond *//** @} *//******************************************************
  * END of list.h
  ******************************************************************************/
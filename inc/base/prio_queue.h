@@ -65,20 +65,23 @@ struct esPqElem {
  */
 typedef struct esPqElem esPqElem;
 
-/**@brief       Priority Queue structure
- * @api
- */
-struct esPq {
-
 /**@brief       Priority Bit Map structure
+ * @details     Bit map is also used by other containers which need O(1)
+ *              selection of the highest priority, see @ref esQpSet.
  * @notapi
  */
-    struct esPqBitmap {
+struct esPqBitmap {
 #if   (CONFIG_PQ_PRIORITY_LEVELS > ES_CPU_DEF_DATA_WIDTH) || defined(__DOXYGEN__)
-        esAtomic        bitGroup;                                               /**<@brief Bit list indicator                               */
+    esAtomic            bitGroup;                                               /**<@brief Bit list indicator                               */
 #endif
-        esAtomic        bit[ES_DIVISION_ROUNDUP(CONFIG_PQ_PRIORITY_LEVELS, ES_CPU_DEF_DATA_WIDTH)]; /**< @brief Bit priority indicator     */
-    }                   bitmap;                                                 /**<@brief Priority bitmap                                  */
+    esAtomic            bit[ES_DIVISION_ROUNDUP(CONFIG_PQ_PRIORITY_LEVELS, ES_CPU_DEF_DATA_WIDTH)]; /**< @brief Bit priority indicator         */
+};
+
+/**@brief       Priority Queue structure
+ * @api
+ */
+struct esPq {
+    struct esPqBitmap   bitmap;                                                 /**<@brief Priority bitmap                                  */
 
 /**@brief       Priority linked list sentinel structure
  * @notapi
@@ -100,6 +103,140 @@ typedef struct esPq esPq;
 /*======================================================  GLOBAL VARIABLES  ==*/
 /*===================================================  FUNCTION PROTOTYPES  ==*/
 
+/**@brief       Initialize bitmap
+ * @param       bitmap
+ *              Pointer to the bit map structure
+ * @notapi
+ */
+static PORT_C_INLINE void esPqBitmapInit_(
+    struct esPqBitmap * bitmap) {
+
+#if   (CONFIG_PQ_PRIORITY_LEVELS > ES_CPU_DEF_DATA_WIDTH)
+    uint_fast8_t        grp;
+
+    bitmap->bitGroup = 0u;
+    grp = ES_DIVISION_ROUNDUP(CONFIG_PQ_PRIORITY_LEVELS, ES_CPU_DEF_DATA_WIDTH);
+
+    while (grp != 0u) {
+        --grp;
+        bitmap->bit[grp] = 0u;
+    }
+#else
+    bitmap->bit[0] = 0u;
+#endif
+}
+
+/**@brief       Set the bit corresponding to the priority argument
+ * @param       bitmap
+ *              Pointer to the bit map structure
+ * @param       priority
+ *              Priority which will be marked as used
+ * @notapi
+ */
+static PORT_C_INLINE void esPqBitmapSet_(
+    struct esPqBitmap * bitmap,
+    uint_fast8_t        priority) {
+
+#if   (CONFIG_PQ_PRIORITY_LEVELS > ES_CPU_DEF_DATA_WIDTH)
+    uint_fast8_t        grpIndx;
+    uint_fast8_t        bitIndx;
+
+    bitIndx               = priority & (ES_CPU_DEF_DATA_WIDTH - 1u);
+    grpIndx               = priority >> ES_UINT8_LOG2(ES_CPU_DEF_DATA_WIDTH);
+    bitmap->bitGroup     |= ES_CPU_PWR2(grpIndx);
+    bitmap->bit[grpIndx] |= ES_CPU_PWR2(bitIndx);
+#else
+    bitmap->bit[0] |= ES_CPU_PWR2(priority);
+#endif
+}
+
+/**@brief       Clear the bit corresponding to the priority argument
+ * @param       bitmap
+ *              Pointer to the bit map structure
+ * @param       priority
+ *              Priority which will be marked as unused
+ * @notapi
+ */
+static PORT_C_INLINE void esPqBitmapClear_(
+    struct esPqBitmap * bitmap,
+    uint_fast8_t        priority) {
+
+#if   (CONFIG_PQ_PRIORITY_LEVELS > ES_CPU_DEF_DATA_WIDTH)
+    uint_fast8_t        grpIndx;
+    uint_fast8_t        bitIndx;
+
+    bitIndx               = priority & (ES_CPU_DEF_DATA_WIDTH - 1u);
+    grpIndx               = priority >> ES_UINT8_LOG2(ES_CPU_DEF_DATA_WIDTH);
+    bitmap->bit[grpIndx] &= ~ES_CPU_PWR2(bitIndx);
+
+    if (bitmap->bit[grpIndx] == 0u) {                                           /* Is this the last one bit cleared in this list?           */
+        bitmap->bitGroup &= ~ES_CPU_PWR2(grpIndx);                              /* Yes: then clear bit list indicator, too.                 */
+    }
+#else
+    bitmap->bit[0] &= ~ES_CPU_PWR2(priority);
+#endif
+}
+
+/**@brief       Get the highest priority set
+ * @param       bitmap
+ *              Pointer to the bit map structure
+ * @return      The number of the highest priority marked as used
+ * @notapi
+ */
+static PORT_C_INLINE uint_fast8_t esPqBitmapGetHighest_(
+    const struct esPqBitmap * bitmap) {
+
+#if   (CONFIG_PQ_PRIORITY_LEVELS > ES_CPU_DEF_DATA_WIDTH)
+    uint_fast8_t        grpIndx;
+    uint_fast8_t        bitIndx;
+
+    grpIndx = ES_CPU_FLS(bitmap->bitGroup);
+    bitIndx = ES_CPU_FLS(bitmap->bit[grpIndx]);
+
+    return ((grpIndx << ES_UINT8_LOG2(ES_CPU_DEF_DATA_WIDTH)) | bitIndx);
+#else
+    uint_fast8_t        bitIndx;
+
+    bitIndx = ES_CPU_FLS(bitmap->bit[0]);
+
+    return (bitIndx);
+#endif
+}
+
+/**@brief       Is bit map empty?
+ * @param       bitmap
+ *              Pointer to the bit map structure
+ * @return      The status of the bit map
+ *  @retval     true - bit map is empty
+ *  @retval     false - there is at least one bit set
+ * @notapi
+ */
+static PORT_C_INLINE bool esPqBitmapIsEmpty_(
+    const struct esPqBitmap * bitmap) {
+
+#if   (CONFIG_PQ_PRIORITY_LEVELS > ES_CPU_DEF_DATA_WIDTH)
+    bool              ret;
+
+    if (bitmap->bitGroup == 0u) {
+        ret = true;
+    } else {
+        ret = false;
+    }
+
+    return (ret);
+#else
+    bool              ret;
+
+    if (bitmap->bit[0] == 0u) {
+        ret = true;
+    } else {
+        ret = false;
+    }
+
+    return (ret);
+#endif
+}
+
 void esPqInit(
     struct esPq *       queue);
 
@@ -35,12 +35,308 @@
 #include <stdint.h>
 #include <stddef.h>
 #include "plat/compiler.h"
+#include "base/debug.h"
+#include "base/queue_config.h"
 
 /*===============================================================  MACRO's  ==*/
 
 #define ES_QP_SIZEOF(elements)                                                  \
     (sizeof(void * [1]) * (elements))
 
+/**@brief       Calculate the size of typed queue buffer
+ * @param       type
+ *              Type of queue element
+ * @param       elements
+ *              Number of elements in queue
+ * @api
+ */
+#define ES_QUEUE_SIZEOF(type, elements)                                         \
+    (sizeof(type [1]) * (elements))
+
+/**@brief       Define a queue which stores elements of given type by value
+ * @param       name
+ *              Name of the queue structure and prefix of its functions
+ * @param       type
+ *              Type of queue element
+ * @details     The macro defines <code>struct name</code> and a set of inline
+ *              functions which have the same shape as @ref esQp functions:
+ *              <code>nameInit()</code>, <code>nameTerm()</code>,
+ *              <code>namePutItem()</code>, <code>namePutTailItem()</code>,
+ *              <code>nameGetItem()</code>, <code>nameSize()</code>,
+ *              <code>nameOccupied()</code>, <code>nameFreeSpace()</code>,
+ *              <code>nameIsFull()</code>, <code>nameIsEmpty()</code> and
+ *              <code>nameBuff()</code>. Elements are copied into the queue
+ *              buffer, so small messages do not need to be allocated.
+ *
+ *              Example:
+ * @code
+ *              ES_QUEUE_DEFINE(appEventQ, struct appEvent)
+ *
+ *              static struct appEvent EventBuff[16];
+ *              static struct appEventQ EventQ;
+ *
+ *              appEventQInit(&EventQ, EventBuff, ES_ARRAY_DIMENSION(EventBuff));
+ * @endcode
+ * @api
+ */
+#define ES_QUEUE_DEFINE(name, type)                                             \
+    struct name {                                                               \
+        type *              buff;                                               \
+        uint32_t            head;                                               \
+        uint32_t            tail;                                               \
+        uint32_t            free;                                               \
+        uint32_t            size;                                               \
+    };                                                                          \
+                                                                                \
+    typedef struct name name;                                                   \
+                                                                                \
+    static PORT_C_INLINE PORT_C_UNUSED void name##Init(                         \
+        struct name *       q,                                                  \
+        type *              buff,                                               \
+        size_t              size) {                                             \
+                                                                                \
+        q->buff = buff;                                                         \
+        q->head = UINT32_C(0);                                                  \
+        q->tail = UINT32_C(0);                                                  \
+        q->free = (uint32_t)size;                                               \
+        q->size = (uint32_t)size;                                               \
+    }                                                                           \
+                                                                                \
+    static PORT_C_INLINE PORT_C_UNUSED void name##Term(                         \
+        struct name *       q) {                                                \
+                                                                                \
+        q->buff = NULL;                                                         \
+        q->head = UINT32_C(0);                                                  \
+        q->tail = UINT32_C(0);                                                  \
+        q->free = UINT32_C(0);                                                  \
+        q->size = UINT32_C(0);                                                  \
+    }                                                                           \
+                                                                                \
+    static PORT_C_INLINE PORT_C_UNUSED void name##PutItem(                      \
+        struct name *       q,                                                  \
+        type                item) {                                             \
+                                                                                \
+        ES_API_REQUIRE_A(ES_API_USAGE, q->free != UINT32_C(0));                 \
+                                                                                \
+        q->buff[q->head++] = item;                                              \
+                                                                                \
+        if (q->head == q->size) {                                               \
+            q->head = UINT32_C(0);                                              \
+        }                                                                       \
+        --q->free;                                                              \
+    }                                                                           \
+                                                                                \
+    static PORT_C_INLINE PORT_C_UNUSED void name##PutTailItem(                  \
+        struct name *       q,                                                  \
+        type                item) {                                             \
+                                                                                \
+        ES_API_REQUIRE_A(ES_API_USAGE, q->free != UINT32_C(0));                 \
+                                                                                \
+        if (q->tail == UINT32_C(0)) {                                           \
+            q->tail = q->size;                                                  \
+        }                                                                       \
+        q->buff[--q->tail] = item;                                              \
+        --q->free;                                                              \
+    }                                                                           \
+                                                                                \
+    static PORT_C_INLINE PORT_C_UNUSED type name##GetItem(                      \
+        struct name *       q) {                                                \
+                                                                                \
+        type                tmp;                                                \
+                                                                                \
+        ES_API_REQUIRE_A(ES_API_USAGE, q->free != q->size);                     \
+                                                                                \
+        tmp = q->buff[q->tail++];                                               \
+                                                                                \
+        if (q->tail == q->size) {                                               \
+            q->tail = UINT32_C(0);                                              \
+        }                                                                       \
+        ++q->free;                                                              \
+                                                                                \
+        return (tmp);                                                           \
+    }                                                                           \
+                                                                                \
+    static PORT_C_INLINE PORT_C_UNUSED size_t name##Size(                       \
+        const struct name * q) {                                                \
+                                                                                \
+        return ((size_t)(q->size));                                             \
+    }                                                                           \
+                                                                                \
+    static PORT_C_INLINE PORT_C_UNUSED size_t name##Occupied(                   \
+        const struct name * q) {                                                \
+                                                                                \
+        return ((size_t)(q->size - q->free));                                   \
+    }                                                                           \
+                                                                                \
+    static PORT_C_INLINE PORT_C_UNUSED size_t name##FreeSpace(                  \
+        const struct name * q) {                                                \
+                                                                                \
+        return ((size_t)(q->free));                                             \
+    }                                                                           \
+                                                                                \
+    static PORT_C_INLINE PORT_C_UNUSED bool name##IsFull(                       \
+        const struct name * q) {                                                \
+                                                                                \
+        return ((q->free == UINT32_C(0)) ? true : false);                       \
+    }                                                                           \
+                                                                                \
+    static PORT_C_INLINE PORT_C_UNUSED bool name##IsEmpty(                      \
+        const struct name * q) {                                                \
+                                                                                \
+        return ((q->free == q->size) ? true : false);                           \
+    }                                                                           \
+                                                                                \
+    static PORT_C_INLINE PORT_C_UNUSED type * name##Buff(                       \
+        const struct name * q) {                                                \
+                                                                                \
+        return (q->buff);                                                       \
+    }
+
+/**@brief       Define a compact queue with embedded buffer and narrow indexes
+ * @param       name
+ *              Name of the queue structure and prefix of its functions
+ * @param       type
+ *              Type of queue element, use <code>void *</code> for a compact
+ *              pointer queue
+ * @param       indexType
+ *              Unsigned integer type of queue indexes, usually @c uint8_t or
+ *              @c uint16_t
+ * @param       capacity
+ *              Number of elements in queue, a constant expression
+ * @details     The macro defines <code>struct name</code> which holds the
+ *              queue buffer and three indexes of type @c indexType, so the
+ *              queue header takes only a few bytes and there is no buffer
+ *              pointer. The functions have the same shape as functions
+ *              defined by @ref ES_QUEUE_DEFINE, except that
+ *              <code>nameInit()</code> takes no buffer. The capacity is
+ *              checked at compile time against the range of @c indexType.
+ *
+ *              Example:
+ * @code
+ *              ES_QUEUE_DEFINE_COMPACT(connTxQ, void *, uint8_t, 32u)
+ *
+ *              static struct connTxQ TxQ;
+ *
+ *              connTxQInit(&TxQ);
+ * @endcode
+ * @api
+ */
+#define ES_QUEUE_DEFINE_COMPACT(name, type, indexType, capacity)                \
+    ES_ASSERT_STATIC(                                                           \
+        name##_index_type_is_signed,                                            \
+        (indexType)-1 > (indexType)0);                                          \
+    ES_ASSERT_STATIC(                                                           \
+        name##_capacity_out_of_range,                                           \
+        ((capacity) != 0u) &&                                                   \
+        ((uintmax_t)(capacity) <= (uintmax_t)(indexType)-1));                   \
+                                                                                \
+    struct name {                                                               \
+        indexType           head;                                               \
+        indexType           tail;                                               \
+        indexType           free;                                               \
+        type                buff[capacity];                                     \
+    };                                                                          \
+                                                                                \
+    typedef struct name name;                                                   \
+                                                                                \
+    static PORT_C_INLINE PORT_C_UNUSED void name##Init(                         \
+        struct name *       q) {                                                \
+                                                                                \
+        q->head = (indexType)0;                                                 \
+        q->tail = (indexType)0;                                                 \
+        q->free = (indexType)(capacity);                                        \
+    }                                                                           \
+                                                                                \
+    static PORT_C_INLINE PORT_C_UNUSED void name##Term(                         \
+        struct name *       q) {                                                \
+                                                                                \
+        q->head = (indexType)0;                                                 \
+        q->tail = (indexType)0;                                                 \
+        q->free = (indexType)0;                                                 \
+    }                                                                           \
+                                                                                \
+    static PORT_C_INLINE PORT_C_UNUSED void name##PutItem(                      \
+        struct name *       q,                                                  \
+        type                item) {                                             \
+                                                                                \
+        ES_API_REQUIRE_A(ES_API_USAGE, q->free != (indexType)0);                \
+                                                                                \
+        q->buff[q->head++] = item;                                              \
+                                                                                \
+        if (q->head == (indexType)(capacity)) {                                 \
+            q->head = (indexType)0;                                             \
+        }                                                                       \
+        --q->free;                                                              \
+    }                                                                           \
+                                                                                \
+    static PORT_C_INLINE PORT_C_UNUSED void name##PutTailItem(                  \
+        struct name *       q,                                                  \
+        type                item) {                                             \
+                                                                                \
+        ES_API_REQUIRE_A(ES_API_USAGE, q->free != (indexType)0);                \
+                                                                                \
+        if (q->tail == (indexType)0) {                                          \
+            q->tail = (indexType)(capacity);                                    \
+        }                                                                       \
+        q->buff[--q->tail] = item;                                              \
+        --q->free;                                                              \
+    }                                                                           \
+                                                                                \
+    static PORT_C_INLINE PORT_C_UNUSED type name##GetItem(                      \
+        struct name *       q) {                                                \
+                                                                                \
+        type                tmp;                                                \
+                                                                                \
+        ES_API_REQUIRE_A(ES_API_USAGE, q->free != (indexType)(capacity));       \
+                                                                                \
+        tmp = q->buff[q->tail++];                                               \
+                                                                                \
+        if (q->tail == (indexType)(capacity)) {                                 \
+            q->tail = (indexType)0;                                             \
+        }                                                                       \
+        ++q->free;                                                              \
+                                                                                \
+        return (tmp);                                                           \
+    }                                                                           \
+                                                                                \
+    static PORT_C_INLINE PORT_C_UNUSED size_t name##Size(                       \
+        const struct name * q) {                                                \
+                                                                                \
+        (void)q;                                                                \
+                                                                                \
+        return ((size_t)(capacity));                                            \
+    }                                                                           \
+                                                                                \
+    static PORT_C_INLINE PORT_C_UNUSED size_t name##Occupied(                   \
+        const struct name * q) {                                                \
+                                                                                \
+        return ((size_t)(capacity) - (size_t)q->free);                          \
+    }                                                                           \
+                                                                                \
+    static PORT_C_INLINE PORT_C_UNUSED size_t name##FreeSpace(                  \
+        const struct name * q) {                                                \
+                                                                                \
+        return ((size_t)(q->free));                                             \
+    }                                                                           \
+                                                                                \
+    static PORT_C_INLINE PORT_C_UNUSED bool name##IsFull(                       \
+        const struct name * q) {                                                \
+                                                                                \
+        return ((q->free == (indexType)0) ? true : false);                      \
+    }                                                                           \
+                                                                                \
+    static PORT_C_INLINE PORT_C_UNUSED bool name##IsEmpty(                      \
+        const struct name * q) {                                                \
+                                                                                \
+        return ((q->free == (indexType)(capacity)) ? true : false);             \
+    }                                                                           \
+                                                                                \
+    static PORT_C_INLINE PORT_C_UNUSED type * name##Buff(                       \
+        struct name *       q) {                                                \
+                                                                                \
+        return (q->buff);                                                       \
+    }
+
 /*-------------------------------------------------------  C++ extern base  --*/
 #ifdef __cplusplus
 extern "C" {
@@ -48,6 +344,31 @@ extern "C" {
 
 /*============================================================  DATA TYPES  ==*/
 
+/**@brief       Pointer queue statistics
+ * @details     Time is measured by @ref CONFIG_QP_STATISTICS_CLOCK. Counters
+ *              wrap around, so they should be scraped and reset periodically,
+ *              see @ref esQpStatsSnapshot and @ref esQpStatsReset. Every item
+ *              leaves the queue either by a get or by a drop, so puts minus
+ *              gets minus dropped equals the change of occupancy since the
+ *              last reset.
+ * @api
+ */
+struct esQpStats {
+    uint32_t            highWater;                                              /**<@brief Maximal number of items in queue                 */
+    uint32_t            rejected;                                               /**<@brief Number of puts rejected because queue was full   */
+    uint32_t            puts;                                                   /**<@brief Number of items put into queue                   */
+    uint32_t            gets;                                                   /**<@brief Number of items taken from queue                 */
+    uint32_t            dropped;                                                /**<@brief Number of items overwritten in full queue        */
+    uint64_t            occupancyTime;                                          /**<@brief Sum of occupancy multiplied by its duration      */
+    uint32_t            startTime;                                              /**<@brief Time when statistics were reset                  */
+    uint32_t            lastTime;                                               /**<@brief Time of the last occupancy change                */
+};
+
+/**@brief       Pointer queue statistics type
+ * @api
+ */
+typedef struct esQpStats esQpStats;
+
 /**@brief       Pointer queue
  * @api
  */
@@ -57,6 +378,9 @@ struct esQp {
     uint32_t            tail;
     uint32_t            free;
     uint32_t            size;
+#if   (1 == CONFIG_QP_STATISTICS) || defined(__DOXYGEN__)
+    struct esQpStats    stats;                                                  /**<@brief Queue statistics                                 */
+#endif
 };
 
 typedef struct esQp esQp;
@@ -66,6 +390,162 @@ typedef void * esQpItem;
 /*======================================================  GLOBAL VARIABLES  ==*/
 /*===================================================  FUNCTION PROTOTYPES  ==*/
 
+#if (1 == CONFIG_QP_STATISTICS)
+
+/**@brief       Add the current occupancy to the time weighted sum
+ * @notapi
+ */
+static PORT_C_INLINE void esQpStatsUpdate_(
+    struct esQp *       qp) {
+
+    uint32_t            now;
+
+    now = CONFIG_QP_STATISTICS_CLOCK();
+    qp->stats.occupancyTime += (uint64_t)(qp->size - qp->free) * (uint32_t)(now - qp->stats.lastTime);
+    qp->stats.lastTime       = now;
+}
+
+/**@brief       Account items which are about to be put into the queue
+ * @notapi
+ */
+static PORT_C_INLINE void esQpStatsPut_(
+    struct esQp *       qp,
+    uint32_t            count) {
+
+    uint32_t            occupied;
+
+    esQpStatsUpdate_(qp);
+    occupied         = qp->size - qp->free + count;
+    qp->stats.puts  += count;
+
+    if (qp->stats.highWater < occupied) {
+        qp->stats.highWater = occupied;
+    }
+}
+
+/**@brief       Account items which are about to be taken from the queue
+ * @notapi
+ */
+static PORT_C_INLINE void esQpStatsGet_(
+    struct esQp *       qp,
+    uint32_t            count) {
+
+    esQpStatsUpdate_(qp);
+    qp->stats.gets += count;
+}
+
+/**@brief       Account a put which was rejected because the queue was full
+ * @notapi
+ */
+static PORT_C_INLINE void esQpStatsReject_(
+    struct esQp *       qp) {
+
+    qp->stats.rejected++;
+}
+
+/**@brief       Account an item which is about to be dropped from the queue
+ * @notapi
+ */
+static PORT_C_INLINE void esQpStatsDrop_(
+    struct esQp *       qp) {
+
+    esQpStatsUpdate_(qp);
+    qp->stats.dropped++;
+}
+#else
+static PORT_C_INLINE void esQpStatsPut_(
+    struct esQp *       qp,
+    uint32_t            count) {
+
+    (void)qp;
+    (void)count;
+}
+
+static PORT_C_INLINE void esQpStatsGet_(
+    struct esQp *       qp,
+    uint32_t            count) {
+
+    (void)qp;
+    (void)count;
+}
+
+static PORT_C_INLINE void esQpStatsReject_(
+    struct esQp *       qp) {
+
+    (void)qp;
+}
+
+static PORT_C_INLINE void esQpStatsDrop_(
+    struct esQp *       qp) {
+
+    (void)qp;
+}
+#endif
+
+#if (1 == CONFIG_QP_STATISTICS) || defined(__DOXYGEN__)
+
+/**@brief       Reset queue statistics
+ * @param       qp
+ *              Pointer to pointer queue
+ * @details     The high-water mark is set to the current occupancy and the
+ *              time weighted occupancy starts from the current time.
+ * @api
+ */
+static PORT_C_INLINE void esQpStatsReset(
+    struct esQp *       qp) {
+
+    qp->stats.highWater     = qp->size - qp->free;
+    qp->stats.rejected      = UINT32_C(0);
+    qp->stats.puts          = UINT32_C(0);
+    qp->stats.gets          = UINT32_C(0);
+    qp->stats.dropped       = UINT32_C(0);
+    qp->stats.occupancyTime = UINT64_C(0);
+    qp->stats.startTime     = CONFIG_QP_STATISTICS_CLOCK();
+    qp->stats.lastTime      = qp->stats.startTime;
+}
+
+/**@brief       Take a snapshot of queue statistics
+ * @param       qp
+ *              Pointer to pointer queue
+ * @param       stats
+ *              Pointer to structure which will receive the statistics
+ * @details     The time weighted occupancy in the snapshot includes the time
+ *              up to this call. Use @ref esQpStatsAverage to get the average
+ *              occupancy.
+ * @api
+ */
+static PORT_C_INLINE void esQpStatsSnapshot(
+    struct esQp *       qp,
+    struct esQpStats *  stats) {
+
+    esQpStatsUpdate_(qp);
+    *stats = qp->stats;
+}
+
+/**@brief       Get time weighted average occupancy from a snapshot
+ * @param       stats
+ *              Pointer to statistics snapshot
+ * @return      Average number of items in queue since the last reset, rounded
+ *              down. When no time has passed the current high-water mark is
+ *              returned.
+ * @api
+ */
+static PORT_C_INLINE uint32_t esQpStatsAverage(
+    const struct esQpStats * stats) {
+
+    uint32_t            elapsed;
+
+    elapsed = stats->lastTime - stats->startTime;
+
+    if (elapsed == UINT32_C(0)) {
+
+        return (stats->highWater);
+    }
+
+    return ((uint32_t)(stats->occupancyTime / elapsed));
+}
+#endif
+
 static PORT_C_INLINE void esQpInit(
     struct esQp *       qp,
     void **             buff,
@@ -76,6 +556,9 @@ static PORT_C_INLINE void esQpInit(
     qp->tail = UINT32_C(0);
     qp->free = (uint32_t)size;
     qp->size = (uint32_t)size;
+#if (1 == CONFIG_QP_STATISTICS)
+    esQpStatsReset(qp);
+#endif
 }
 
 static PORT_C_INLINE void esQpTerm(
@@ -86,12 +569,18 @@ static PORT_C_INLINE void esQpTerm(
     qp->tail = UINT32_C(0);
     qp->free = UINT32_C(0);
     qp->size = UINT32_C(0);
+#if (1 == CONFIG_QP_STATISTICS)
+    esQpStatsReset(qp);
+#endif
 }
 
 static PORT_C_INLINE void esQpPutItem(
     struct esQp *       qp,
     void *              item) {
 
+    ES_API_REQUIRE_A(ES_API_USAGE, qp->free != UINT32_C(0));
+
+    esQpStatsPut_(qp, UINT32_C(1));
     qp->buff[qp->head++] = item;
 
     if (qp->head == qp->size) {
@@ -104,6 +593,10 @@ static PORT_C_INLINE void esQpPutTailItem(
     struct esQp *       qp,
     void *              item) {
 
+    ES_API_REQUIRE_A(ES_API_USAGE, qp->free != UINT32_C(0));
+
+    esQpStatsPut_(qp, UINT32_C(1));
+
     if (qp->tail == UINT32_C(0)) {
         qp->tail = qp->size;
     }
@@ -116,6 +609,9 @@ static PORT_C_INLINE void * esQpGetItem(
 
     void *              tmp;
 
+    ES_API_REQUIRE_A(ES_API_USAGE, qp->free != qp->size);
+
+    esQpStatsGet_(qp, UINT32_C(1));
     tmp = qp->buff[qp->tail++];
 
     if (qp->tail == qp->size) {
@@ -126,6 +622,211 @@ static PORT_C_INLINE void * esQpGetItem(
     return (tmp);
 }
 
+/**@brief       Try to put an item into the queue
+ * @param       qp
+ *              Pointer to pointer queue
+ * @param       item
+ *              Item to put
+ * @return      Was the item put into the queue?
+ *  @retval     true - the item was put into the queue
+ *  @retval     false - the queue is full, the rejection is counted in queue
+ *              statistics
+ * @api
+ */
+static PORT_C_INLINE bool esQpTryPutItem(
+    struct esQp *       qp,
+    void *              item) {
+
+    if (qp->free == UINT32_C(0)) {
+        esQpStatsReject_(qp);
+
+        return (false);
+    }
+    esQpPutItem(
+        qp,
+        item);
+
+    return (true);
+}
+
+/**@brief       Put an item into the queue, overwrite the oldest item when the
+ *              queue is full
+ * @param       qp
+ *              Pointer to pointer queue
+ * @param       item
+ *              Item to put
+ * @param       oldItem
+ *              Pointer to variable which will receive the overwritten item.
+ *              This parameter can be NULL when the overwritten item is not
+ *              needed.
+ * @return      Was the oldest item overwritten?
+ *  @retval     true - the queue was full and the oldest item was dropped
+ *  @retval     false - the item was put into a free slot
+ * @details     This function never fails, so a producer does not need to
+ *              check @ref esQpIsFull first. When @ref CONFIG_QP_STATISTICS is
+ *              enabled dropped items are counted, see @ref esQpDropped.
+ * @note        The drop path is not atomic. Every queue function, including
+ *              @ref esQpPutItem, updates the @c free counter which is shared
+ *              by producer and consumer, and the base layer has no portable
+ *              compare and swap, so making only this path atomic would not
+ *              make the queue safe. Concurrent access must be serialized by
+ *              the caller in the same way as for @ref esQpPutItem: when the
+ *              producer is an interrupt handler, the consumer gets items
+ *              while the interrupt is masked. Using this function adds no
+ *              locking cost compared to @ref esQpPutItem.
+ * @api
+ */
+static PORT_C_INLINE bool esQpPutItemOverwrite(
+    struct esQp *       qp,
+    void *              item,
+    void **             oldItem) {
+
+    bool                isDropped;
+
+    if (qp->free == UINT32_C(0)) {
+        isDropped = true;
+        esQpStatsDrop_(qp);
+
+        if (oldItem != NULL) {
+            *oldItem = qp->buff[qp->tail];
+        }
+        qp->tail++;
+
+        if (qp->tail == qp->size) {
+            qp->tail = UINT32_C(0);
+        }
+        qp->free++;
+    } else {
+        isDropped = false;
+    }
+    esQpPutItem(
+        qp,
+        item);
+
+    return (isDropped);
+}
+
+#if (1 == CONFIG_QP_STATISTICS) || defined(__DOXYGEN__)
+
+/**@brief       Get the number of items dropped by @ref esQpPutItemOverwrite
+ * @details     The counter is a part of queue statistics and it is cleared by
+ *              @ref esQpStatsReset.
+ * @api
+ */
+static PORT_C_INLINE uint32_t esQpDropped(
+    const struct esQp * qp) {
+
+    return (qp->stats.dropped);
+}
+#endif
+
+/**@brief       Peek at the largest contiguous run of items
+ * @param       qp
+ *              Pointer to pointer queue
+ * @param       span
+ *              Pointer to variable which will receive the pointer to the
+ *              oldest item in queue buffer
+ * @return      Number of items in the run
+ *  @retval     0 - the queue is empty
+ * @details     The run ends at the newest item or at the end of queue buffer,
+ *              whichever comes first. Items stay in the queue until they are
+ *              consumed by @ref esQpConsume. When the queue wraps, the rest of
+ *              items is returned by the next call after consume.
+ * @api
+ */
+static PORT_C_INLINE size_t esQpPeekSpan(
+    const struct esQp * qp,
+    void ***            span) {
+
+    uint32_t            occupied;
+    uint32_t            contiguous;
+
+    occupied = qp->size - qp->free;
+
+    if (occupied == UINT32_C(0)) {
+
+        return (0u);
+    }
+    *span      = &qp->buff[qp->tail];
+    contiguous = qp->size - qp->tail;
+
+    return ((size_t)((occupied < contiguous) ? occupied : contiguous));
+}
+
+/**@brief       Remove the oldest items from the queue
+ * @param       qp
+ *              Pointer to pointer queue
+ * @param       count
+ *              Number of items to remove, usually the number of items
+ *              processed from the run returned by @ref esQpPeekSpan
+ * @api
+ */
+static PORT_C_INLINE void esQpConsume(
+    struct esQp *       qp,
+    size_t              count) {
+
+    ES_API_REQUIRE_A(ES_API_RANGE, count <= (size_t)(qp->size - qp->free));
+
+    esQpStatsGet_(qp, (uint32_t)count);
+    qp->tail += (uint32_t)count;
+
+    if (qp->tail >= qp->size) {
+        qp->tail -= qp->size;
+    }
+    qp->free += (uint32_t)count;
+}
+
+/**@brief       Reserve the largest contiguous run of free slots
+ * @param       qp
+ *              Pointer to pointer queue
+ * @param       span
+ *              Pointer to variable which will receive the pointer to the first
+ *              free slot in queue buffer
+ * @return      Number of free slots in the run
+ *  @retval     0 - the queue is full
+ * @details     Producer writes items directly into the run and then makes
+ *              them visible by @ref esQpPublish.
+ * @api
+ */
+static PORT_C_INLINE size_t esQpReserveSpan(
+    const struct esQp * qp,
+    void ***            span) {
+
+    uint32_t            contiguous;
+
+    if (qp->free == UINT32_C(0)) {
+
+        return (0u);
+    }
+    *span      = &qp->buff[qp->head];
+    contiguous = qp->size - qp->head;
+
+    return ((size_t)((qp->free < contiguous) ? qp->free : contiguous));
+}
+
+/**@brief       Add items written into the reserved run to the queue
+ * @param       qp
+ *              Pointer to pointer queue
+ * @param       count
+ *              Number of items written, not more than returned by
+ *              @ref esQpReserveSpan
+ * @api
+ */
+static PORT_C_INLINE void esQpPublish(
+    struct esQp *       qp,
+    size_t              count) {
+
+    ES_API_REQUIRE_A(ES_API_RANGE, count <= (size_t)qp->free);
+
+    esQpStatsPut_(qp, (uint32_t)count);
+    qp->head += (uint32_t)count;
+
+    if (qp->head >= qp->size) {
+        qp->head -= qp->size;
+    }
+    qp->free -= (uint32_t)count;
+}
+
 static PORT_C_INLINE size_t esQpSize(
     const struct esQp * qp) {
 
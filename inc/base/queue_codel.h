@@ -0,0 +1,190 @@
+/*
+ * This file is part of eSolid.
+ *
+ * Copyright (C) 2010 - 2013 Nenad Radulovic
+ *
+ * eSolid is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * eSolid is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with eSolid.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * web site:    http://github.com/nradulovic
+ * e-mail  :    nenad.b.radulovic@gmail.com
+ *//***********************************************************************//**
+ * @file
+ * @author      Nenad Radulovic
+ * @brief       Pointer queue with delay based active queue management header
+ * @defgroup    base_queue_codel Delay managed queue
+ * @brief       Delay managed queue
+ *********************************************************************//** @{ */
+/**@defgroup    base_queue_codel_intf Interface
+ * @brief       Delay managed queue API
+ * @details     Delay managed queue is a pointer queue which timestamps each
+ *              item when it is put into the queue and measures the time the
+ *              item has spent in the queue (sojourn time) when it is taken out
+ *              of the queue. When the sojourn time stays above @c target for
+ *              at least @c interval the queue enters dropping state, as
+ *              described by CoDel algorithm (RFC 8289). In dropping state
+ *              items are marked for dropping at intervals which get shorter
+ *              with inverse square root of number of drops, until sojourn time
+ *              drops below the target.
+ *
+ *              The queue does not free marked items itself: @ref
+ *              esQpCodelGetItem returns each item together with the verdict
+ *              and the caller either drops it or marks it and processes it.
+ *
+ *              Time is given by the caller in arbitrary ticks which wrap
+ *              around at 32 bits, for example system timer ticks.
+ * @{ *//*--------------------------------------------------------------------*/
+
+#ifndef ES_QUEUE_CODEL_H_
+#define ES_QUEUE_CODEL_H_
+
+/*=========================================================  INCLUDE FILES  ==*/
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stddef.h>
+
+#include "plat/compiler.h"
+#include "base/debug.h"
+#include "base/queue.h"
+
+/*===============================================================  MACRO's  ==*/
+
+/**@brief       Calculate the size of timestamp buffer
+ * @param       elements
+ *              Number of elements in queue
+ * @api
+ */
+#define ES_QP_CODEL_STAMP_SIZEOF(elements)                                      \
+    (sizeof(uint32_t [1]) * (elements))
+
+/*------------------------------------------------------  C++ extern begin  --*/
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*============================================================  DATA TYPES  ==*/
+
+/**@brief       Delay managed queue
+ * @api
+ */
+struct esQpCodel {
+    struct esQp         qp;                                                     /**<@brief Pointer queue holding the items                  */
+    uint32_t *          stamp;                                                  /**<@brief Put time of each queue slot                      */
+    uint32_t            target;                                                 /**<@brief Acceptable standing queue delay                  */
+    uint32_t            interval;                                               /**<@brief Time to wait before the first drop               */
+    uint32_t            firstAboveTime;                                         /**<@brief Time when dropping may start                     */
+    uint32_t            dropNext;                                               /**<@brief Time of the next drop in dropping state          */
+    uint32_t            count;                                                  /**<@brief Number of drops in current dropping state        */
+    uint32_t            lastCount;                                              /**<@brief Number of drops in previous dropping state       */
+    bool                isAbove;                                                /**<@brief Sojourn time is above target                     */
+    bool                isDropping;                                             /**<@brief Queue is in dropping state                       */
+#if   (1 == CONFIG_API_VALIDATION) || defined(__DOXYGEN__)
+    esAtomic            signature;                                              /**<@brief Delay managed queue structure signature.         */
+#endif
+};
+
+/**@brief       Delay managed queue type
+ * @api
+ */
+typedef struct esQpCodel esQpCodel;
+
+/*======================================================  GLOBAL VARIABLES  ==*/
+/*===================================================  FUNCTION PROTOTYPES  ==*/
+
+/**@brief       Initialize delay managed queue
+ * @param       qc
+ *              Pointer to delay managed queue
+ * @param       buff
+ *              Item buffer, see @ref ES_QP_SIZEOF
+ * @param       stamp
+ *              Timestamp buffer, see @ref ES_QP_CODEL_STAMP_SIZEOF
+ * @param       size
+ *              Number of elements in both buffers
+ * @param       target
+ *              Acceptable standing queue delay in ticks
+ * @param       interval
+ *              Time in ticks the delay must stay above target before items
+ *              are dropped. It should be about worst case round trip time of
+ *              the consumer.
+ * @api
+ */
+void esQpCodelInit(
+    struct esQpCodel *  qc,
+    void **             buff,
+    uint32_t *          stamp,
+    size_t              size,
+    uint32_t            target,
+    uint32_t            interval);
+
+void esQpCodelTerm(
+    struct esQpCodel *  qc);
+
+/**@brief       Put an item into the queue and timestamp it
+ * @param       qc
+ *              Pointer to delay managed queue
+ * @param       item
+ *              Item to put
+ * @param       now
+ *              Current time in ticks
+ * @api
+ */
+void esQpCodelPutItem(
+    struct esQpCodel *  qc,
+    void *              item,
+    uint32_t            now);
+
+/**@brief       Get an item from the queue and apply drop policy
+ * @param       qc
+ *              Pointer to delay managed queue
+ * @param       now
+ *              Current time in ticks
+ * @param       isDropped
+ *              Pointer to variable which will receive the verdict. When it is
+ *              @c true the caller should drop (or mark) the item.
+ * @return      The oldest item in the queue
+ * @api
+ */
+void * esQpCodelGetItem(
+    struct esQpCodel *  qc,
+    uint32_t            now,
+    bool *              isDropped);
+
+static PORT_C_INLINE size_t esQpCodelOccupied(
+    const struct esQpCodel * qc) {
+
+    return (esQpOccupied(&qc->qp));
+}
+
+static PORT_C_INLINE bool esQpCodelIsFull(
+    const struct esQpCodel * qc) {
+
+    return (esQpIsFull(&qc->qp));
+}
+
+static PORT_C_INLINE bool esQpCodelIsEmpty(
+    const struct esQpCodel * qc) {
+
+    return (esQpIsEmpty(&qc->qp));
+}
+
+/*--------------------------------------------------------  C++ extern end  --*/
+#ifdef __cplusplus
+}
+#endif
+
+/*================================*//** @cond *//*==  CONFIGURATION ERRORS  ==*/
+/** @endcond *//** @} *//** @} *//*********************************************
+ * END of queue_codel.h
+ ******************************************************************************/
+#endif /* ES_QUEUE_CODEL_H_ */
@@ -0,0 +1,76 @@
+/*
+ * This file is part of eSolid.
+ *
+ * Copyright (C) 2010 - 2013 Nenad Radulovic
+ *
+ * eSolid is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * eSolid is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with eSolid.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * web site:    http://github.com/nradulovic
+ * e-mail  :    nenad.b.radulovic@gmail.com
+ *//***********************************************************************//**
+ * @file
+ * @author      Nenad Radulovic
+ * @brief       Generic queue configuration
+ * @defgroup    base_queue_cfg Generic queue configuration
+ * @brief       Generic queue configuration
+ *********************************************************************//** @{ */
+/**@defgroup    base_queue_cfg_settings Configuration
+ * @brief       Generic queue configuration
+ * @{ *//*--------------------------------------------------------------------*/
+
+#ifndef ES_QUEUE_CONFIG_H_
+#define ES_QUEUE_CONFIG_H_
+
+/*=========================================================  INCLUDE FILES  ==*/
+/*===============================================================  DEFINES  ==*/
+/*==============================================================  SETTINGS  ==*/
+
+/**@brief       Enable/disable pointer queue statistics
+ * @details     When enabled, each @ref esQp keeps high-water mark, number of
+ *              rejected puts, number of puts and gets and time weighted
+ *              occupancy. When disabled, the statistics are compiled out and
+ *              the queue structure does not contain them.
+ *
+ *              Possible values:
+ *              - 0 - statistics are disabled
+ *              - 1 - statistics are enabled, @ref CONFIG_QP_STATISTICS_CLOCK
+ *                must be defined
+ */
+#if !defined(CONFIG_QP_STATISTICS)
+# define CONFIG_QP_STATISTICS           0
+#endif
+
+/**@brief       Clock used by pointer queue statistics
+ * @details     The macro must expand to an expression which returns current
+ *              time as @c uint32_t ticks, for example system timer ticks. The
+ *              clock may wrap around. There is no default value.
+ */
+#if defined(__DOXYGEN__)
+# define CONFIG_QP_STATISTICS_CLOCK()
+#endif
+
+/*================================*//** @cond *//*==  CONFIGURATION ERRORS  ==*/
+
+#if ((1 != CONFIG_QP_STATISTICS) && (0 != CONFIG_QP_STATISTICS))
+# error "eSolid RT Kernel: Configuration option CONFIG_QP_STATISTICS is out of range."
+#endif
+
+#if (1 == CONFIG_QP_STATISTICS) && !defined(CONFIG_QP_STATISTICS_CLOCK)
+# error "eSolid RT Kernel: Configuration option CONFIG_QP_STATISTICS_CLOCK must be defined when statistics are enabled."
+#endif
+
+/** @endcond *//** @} *//** @} *//*********************************************
+ * END of queue_config.h
+ ******************************************************************************/
+#endif /* ES_QUEUE_CONFIG_H_ */
@@ -0,0 +1,225 @@
+/*
+ * This file is part of eSolid.
+ *
+ * Copyright (C) 2010 - 2013 Nenad Radulovic
+ *
+ * eSolid is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * eSolid is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with eSolid.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * web site:    http://github.com/nradulovic
+ * e-mail  :    nenad.b.radulovic@gmail.com
+ *//***********************************************************************//**
+ * @file
+ * @author      Nenad Radulovic
+ * @brief       Growable pointer queue header
+ * @defgroup    base_queue_grow Growable pointer queue
+ * @brief       Growable pointer queue
+ *********************************************************************//** @{ */
+/**@defgroup    base_queue_grow_intf Interface
+ * @brief       Growable pointer queue API
+ * @details     Growable queue is a pointer queue whose buffer is allocated
+ *              from an allocator. When an item is put into a full queue the
+ *              buffer is doubled, up to the given maximum size, and the
+ *              wrapped contents are copied to the beginning of new buffer in
+ *              one pass. Optionally, the buffer is halved when the queue stays
+ *              at most a quarter full for a number of consecutive gets, but it
+ *              never gets smaller than the initial size.
+ *
+ *              Put and get are inline and they call the allocator only when
+ *              the queue is resized.
+ * @{ *//*--------------------------------------------------------------------*/
+
+#ifndef ES_QUEUE_GROW_H_
+#define ES_QUEUE_GROW_H_
+
+/*=========================================================  INCLUDE FILES  ==*/
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stddef.h>
+
+#include "plat/compiler.h"
+#include "base/debug.h"
+#include "base/error.h"
+#include "base/queue.h"
+#include "base/allocator.h"
+
+/*===============================================================  MACRO's  ==*/
+/*------------------------------------------------------  C++ extern begin  --*/
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*============================================================  DATA TYPES  ==*/
+
+/**@brief       Growable pointer queue
+ * @api
+ */
+struct esQpGrow {
+    struct esQp         qp;                                                     /**<@brief Pointer queue holding the items                  */
+    const struct esAllocator * allocator;                                       /**<@brief Allocator of queue buffer                        */
+    uint32_t            minSize;                                                /**<@brief Initial and minimal number of elements           */
+    uint32_t            maxSize;                                                /**<@brief Maximal number of elements                       */
+    uint32_t            shrinkAfter;                                            /**<@brief Number of gets at low occupancy before shrink    */
+    uint32_t            lowCount;                                               /**<@brief Consecutive gets at low occupancy                */
+#if   (1 == CONFIG_API_VALIDATION) || defined(__DOXYGEN__)
+    esAtomic            signature;                                              /**<@brief Growable queue structure signature.              */
+#endif
+};
+
+/**@brief       Growable pointer queue type
+ * @api
+ */
+typedef struct esQpGrow esQpGrow;
+
+/*======================================================  GLOBAL VARIABLES  ==*/
+/*===================================================  FUNCTION PROTOTYPES  ==*/
+
+/**@brief       Initialize growable queue
+ * @param       qg
+ *              Pointer to growable queue
+ * @param       allocator
+ *              Allocator of queue buffer
+ * @param       minSize
+ *              Initial and minimal number of elements
+ * @param       maxSize
+ *              Maximal number of elements
+ * @param       shrinkAfter
+ *              Number of consecutive gets at low occupancy after which the
+ *              buffer is halved. When it is zero the buffer never shrinks.
+ * @return      Operation status
+ *  @retval     ES_ERROR_NONE - the queue is initialized
+ *  @retval     ES_ERROR_NO_MEMORY - the initial buffer can not be allocated
+ * @api
+ */
+esError esQpGrowInit(
+    struct esQpGrow *   qg,
+    const struct esAllocator * allocator,
+    size_t              minSize,
+    size_t              maxSize,
+    uint32_t            shrinkAfter);
+
+/**@brief       Terminate growable queue and free its buffer
+ * @param       qg
+ *              Pointer to growable queue
+ * @details     Items which are still in the queue are not touched.
+ * @api
+ */
+void esQpGrowTerm(
+    struct esQpGrow *   qg);
+
+/**@brief       Resize queue buffer
+ * @notapi
+ */
+esError esQpGrowResize_(
+    struct esQpGrow *   qg,
+    uint32_t            size);
+
+/**@brief       Put an item into the queue, grow the queue when it is full
+ * @param       qg
+ *              Pointer to growable queue
+ * @param       item
+ *              Item to put
+ * @return      Operation status
+ *  @retval     ES_ERROR_NONE - the item was put into the queue
+ *  @retval     ES_ERROR_NO_MEMORY - the queue is full and it can not grow
+ *              because it has reached maximal size or the allocator failed
+ * @api
+ */
+static PORT_C_INLINE esError esQpGrowPutItem(
+    struct esQpGrow *   qg,
+    void *              item) {
+
+    if (qg->qp.free == UINT32_C(0)) {
+        uint32_t        size;
+        esError         error;
+
+        if (qg->qp.size == qg->maxSize) {
+
+            return (ES_ERROR_NO_MEMORY);
+        }
+        size  = (qg->qp.size > (qg->maxSize / 2u)) ? qg->maxSize : (qg->qp.size * 2u);
+        error = esQpGrowResize_(qg, size);
+
+        if (error != ES_ERROR_NONE) {
+
+            return (error);
+        }
+    }
+    esQpPutItem(
+        &qg->qp,
+        item);
+
+    return (ES_ERROR_NONE);
+}
+
+/**@brief       Get an item from the queue, shrink the queue when it stays
+ *              at low occupancy
+ * @param       qg
+ *              Pointer to growable queue, the queue must not be empty
+ * @return      The oldest item in the queue
+ * @details     A failed shrink is not an error, the queue just keeps the
+ *              larger buffer and tries again later.
+ * @api
+ */
+static PORT_C_INLINE void * esQpGrowGetItem(
+    struct esQpGrow *   qg) {
+
+    void *              item;
+
+    item = esQpGetItem(&qg->qp);
+
+    if ((qg->qp.size - qg->qp.free) > (qg->qp.size / 4u)) {
+        qg->lowCount = 0u;
+    } else if ((qg->shrinkAfter != 0u) && (++qg->lowCount == qg->shrinkAfter)) {
+        qg->lowCount = 0u;
+
+        if (qg->qp.size > qg->minSize) {
+            uint32_t    size;
+
+            size = (qg->qp.size / 2u < qg->minSize) ? qg->minSize : (qg->qp.size / 2u);
+            (void)esQpGrowResize_(qg, size);
+        }
+    }
+
+    return (item);
+}
+
+static PORT_C_INLINE size_t esQpGrowSize(
+    const struct esQpGrow * qg) {
+
+    return (esQpSize(&qg->qp));
+}
+
+static PORT_C_INLINE size_t esQpGrowOccupied(
+    const struct esQpGrow * qg) {
+
+    return (esQpOccupied(&qg->qp));
+}
+
+static PORT_C_INLINE bool esQpGrowIsEmpty(
+    const struct esQpGrow * qg) {
+
+    return (esQpIsEmpty(&qg->qp));
+}
+
+/*--------------------------------------------------------  C++ extern end  --*/
+#ifdef __cplusplus
+}
+#endif
+
+/*================================*//** @cond *//*==  CONFIGURATION ERRORS  ==*/
+/** @endcond *//** @} *//** @} *//*********************************************
+ * END of queue_grow.h
+ ******************************************************************************/
+#endif /* ES_QUEUE_GROW_H_ */
@@ -0,0 +1,159 @@
+/*
+ * This file is part of eSolid.
+ *
+ * Copyright (C) 2010 - 2013 Nenad Radulovic
+ *
+ * eSolid is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * eSolid is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with eSolid.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * web site:    http://github.com/nradulovic
+ * e-mail  :    nenad.b.radulovic@gmail.com
+ *//***********************************************************************//**
+ * @file
+ * @author      Nenad Radulovic
+ * @brief       Multi-level pointer queue header
+ * @defgroup    base_queue_ml Multi-level pointer queue
+ * @brief       Multi-level pointer queue
+ *********************************************************************//** @{ */
+/**@defgroup    base_queue_ml_intf Interface
+ * @brief       Multi-level pointer queue API
+ * @details     Multi-level queue holds one pointer ring for each of
+ *              @ref CONFIG_PQ_PRIORITY_LEVELS priorities and a bitmap with one
+ *              bit per non-empty ring. Items are arbitrary pointers, so they
+ *              do not need an intrusive list node like @ref esPq elements do.
+ *              Putting an item with a given priority and getting the item with
+ *              the highest priority both take constant time. Items of the same
+ *              priority are taken in FIFO order.
+ *
+ *              All rings share one buffer given at initialization, so the
+ *              queue does not allocate memory.
+ * @{ *//*--------------------------------------------------------------------*/
+
+#ifndef ES_QUEUE_ML_H_
+#define ES_QUEUE_ML_H_
+
+/*=========================================================  INCLUDE FILES  ==*/
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stddef.h>
+
+#include "plat/compiler.h"
+#include "base/debug.h"
+#include "base/queue.h"
+#include "base/prio_queue.h"
+
+/*===============================================================  MACRO's  ==*/
+
+/**@brief       Calculate the size of multi-level queue buffer
+ * @param       elements
+ *              Number of elements in each priority ring
+ * @api
+ */
+#define ES_QP_ML_SIZEOF(elements)                                               \
+    ES_QP_SIZEOF((elements) * CONFIG_PQ_PRIORITY_LEVELS)
+
+/*------------------------------------------------------  C++ extern begin  --*/
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*============================================================  DATA TYPES  ==*/
+
+/**@brief       Multi-level pointer queue
+ * @api
+ */
+struct esQpMl {
+    struct esPqBitmap   bitmap;                                                 /**<@brief Bitmap of non-empty rings                        */
+    struct esQp         level[CONFIG_PQ_PRIORITY_LEVELS];                       /**<@brief Rings, indexed by priority                       */
+#if   (1 == CONFIG_API_VALIDATION) || defined(__DOXYGEN__)
+    esAtomic            signature;                                              /**<@brief Multi-level queue structure signature.           */
+#endif
+};
+
+/**@brief       Multi-level pointer queue type
+ * @api
+ */
+typedef struct esQpMl esQpMl;
+
+/*======================================================  GLOBAL VARIABLES  ==*/
+/*===================================================  FUNCTION PROTOTYPES  ==*/
+
+/**@brief       Initialize multi-level queue
+ * @param       ml
+ *              Pointer to multi-level queue
+ * @param       buff
+ *              Queue buffer, see @ref ES_QP_ML_SIZEOF
+ * @param       size
+ *              Number of elements in each priority ring
+ * @api
+ */
+void esQpMlInit(
+    struct esQpMl *     ml,
+    void **             buff,
+    size_t              size);
+
+void esQpMlTerm(
+    struct esQpMl *     ml);
+
+/**@brief       Put an item into the queue
+ * @param       ml
+ *              Pointer to multi-level queue
+ * @param       item
+ *              Item to put
+ * @param       priority
+ *              Priority of the item, the ring of this priority must not be
+ *              full, see @ref esQpMlIsFull
+ * @api
+ */
+void esQpMlPutItem(
+    struct esQpMl *     ml,
+    void *              item,
+    uint_fast8_t        priority);
+
+/**@brief       Get the oldest item with the highest priority
+ * @param       ml
+ *              Pointer to multi-level queue
+ * @param       priority
+ *              Pointer to variable which will receive the item priority. This
+ *              parameter can be NULL when the priority is not needed.
+ * @return      The item
+ * @details     The queue must not be empty, see @ref esQpMlIsEmpty. Items
+ *              are opaque pointers and may be NULL, so NULL can not mark an
+ *              empty queue.
+ * @api
+ */
+void * esQpMlGetHighest(
+    struct esQpMl *     ml,
+    uint_fast8_t *      priority);
+
+/**@brief       Is the ring of given priority full?
+ * @api
+ */
+bool esQpMlIsFull(
+    const struct esQpMl * ml,
+    uint_fast8_t        priority);
+
+bool esQpMlIsEmpty(
+    const struct esQpMl * ml);
+
+/*--------------------------------------------------------  C++ extern end  --*/
+#ifdef __cplusplus
+}
+#endif
+
+/*================================*//** @cond *//*==  CONFIGURATION ERRORS  ==*/
+/** @endcond *//** @} *//** @} *//*********************************************
+ * END of queue_ml.h
+ ******************************************************************************/
+#endif /* ES_QUEUE_ML_H_ */
@@ -0,0 +1,166 @@
+/*
+ * This file is part of eSolid.
+ *
+ * Copyright (C) 2010 - 2013 Nenad Radulovic
+ *
+ * eSolid is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * eSolid is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with eSolid.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * web site:    http://github.com/nradulovic
+ * e-mail  :    nenad.b.radulovic@gmail.com
+ *//***********************************************************************//**
+ * @file
+ * @author      Nenad Radulovic
+ * @brief       Pointer queue set header
+ * @defgroup    base_queue_set Pointer queue set
+ * @brief       Pointer queue set
+ *********************************************************************//** @{ */
+/**@defgroup    base_queue_set_intf Interface
+ * @brief       Pointer queue set API
+ * @details     Queue set groups up to @ref CONFIG_PQ_PRIORITY_LEVELS pointer
+ *              queues. Each attached queue has a priority and the set keeps a
+ *              readiness bitmap with one bit per priority. The bit is updated
+ *              on empty to non-empty transitions and back, so finding the
+ *              highest priority non-empty queue takes constant time, no matter
+ *              how many queues are attached.
+ *
+ *              Attached queues must be accessed only through the set
+ *              functions, otherwise the readiness bitmap gets out of sync.
+ * @{ *//*--------------------------------------------------------------------*/
+
+#ifndef ES_QUEUE_SET_H_
+#define ES_QUEUE_SET_H_
+
+/*=========================================================  INCLUDE FILES  ==*/
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "plat/compiler.h"
+#include "base/debug.h"
+#include "base/queue.h"
+#include "base/prio_queue.h"
+
+/*===============================================================  MACRO's  ==*/
+/*------------------------------------------------------  C++ extern begin  --*/
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*============================================================  DATA TYPES  ==*/
+
+/**@brief       Pointer queue set
+ * @api
+ */
+struct esQpSet {
+    struct esPqBitmap   bitmap;                                                 /**<@brief Readiness bitmap                                 */
+    struct esQp *       queue[CONFIG_PQ_PRIORITY_LEVELS];                       /**<@brief Attached queues, indexed by priority             */
+#if   (1 == CONFIG_API_VALIDATION) || defined(__DOXYGEN__)
+    esAtomic            signature;                                              /**<@brief Queue set structure signature.                   */
+#endif
+};
+
+/**@brief       Pointer queue set type
+ * @api
+ */
+typedef struct esQpSet esQpSet;
+
+/*======================================================  GLOBAL VARIABLES  ==*/
+/*===================================================  FUNCTION PROTOTYPES  ==*/
+
+void esQpSetInit(
+    struct esQpSet *    set);
+
+void esQpSetTerm(
+    struct esQpSet *    set);
+
+/**@brief       Attach a queue to the set
+ * @param       set
+ *              Pointer to queue set
+ * @param       qp
+ *              Pointer to initialized pointer queue
+ * @param       priority
+ *              Priority of the queue, must not be used by another queue
+ * @api
+ */
+void esQpSetAttach(
+    struct esQpSet *    set,
+    struct esQp *       qp,
+    uint_fast8_t        priority);
+
+/**@brief       Detach a queue from the set
+ * @param       set
+ *              Pointer to queue set
+ * @param       priority
+ *              Priority of the queue
+ * @api
+ */
+void esQpSetDetach(
+    struct esQpSet *    set,
+    uint_fast8_t        priority);
+
+/**@brief       Put an item into attached queue
+ * @param       set
+ *              Pointer to queue set
+ * @param       priority
+ *              Priority of the queue
+ * @param       item
+ *              Item to put
+ * @api
+ */
+void esQpSetPutItem(
+    struct esQpSet *    set,
+    uint_fast8_t        priority,
+    void *              item);
+
+/**@brief       Get an item from attached queue
+ * @param       set
+ *              Pointer to queue set
+ * @param       priority
+ *              Priority of the queue, the queue must not be empty
+ * @return      The oldest item in the queue
+ * @api
+ */
+void * esQpSetGetItem(
+    struct esQpSet *    set,
+    uint_fast8_t        priority);
+
+/**@brief       Get the highest priority non-empty queue
+ * @param       set
+ *              Pointer to queue set
+ * @param       priority
+ *              Pointer to variable which will receive the queue priority. The
+ *              variable is not changed when all queues are empty.
+ * @return      Pointer to the queue
+ *  @retval     NULL - all attached queues are empty
+ * @details     The function does not block, it only checks the readiness
+ *              bitmap.
+ * @api
+ */
+struct esQp * esQpSetGetHighest(
+    const struct esQpSet * set,
+    uint_fast8_t *      priority);
+
+bool esQpSetIsEmpty(
+    const struct esQpSet * set);
+
+/*--------------------------------------------------------  C++ extern end  --*/
+#ifdef __cplusplus
+}
+#endif
+
+/*================================*//** @cond *//*==  CONFIGURATION ERRORS  ==*/
+/** @endcond *//** @} *//** @} *//*********************************************
+ * END of queue_set.h
+ ******************************************************************************/
+#endif /* ES_QUEUE_SET_H_ */
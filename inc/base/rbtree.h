@@ -0,0 +1,215 @@
+/*
+ * This file is part of eSolid.
+ *
+ * Copyright (C) 2010 - 2013 Nenad Radulovic
+ *
+ * eSolid is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * eSolid is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with eSolid.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * web site:    http://github.com/nradulovic
+ * e-mail  :    nenad.b.radulovic@gmail.com
+ *//***********************************************************************//**
+ * @file
+ * @author      Nenad Radulovic
+ * @brief       Red-black tree header
+ * @defgroup    base_rbtree Red-black tree
+ * @brief       Red-black tree
+ *********************************************************************//** @{ */
+/**@defgroup    base_rbtree_intf Interface
+ * @brief       Red-black tree API
+ * @details     Intrusive red-black tree. Tree nodes are embedded in the user
+ *              structures, like @ref esDls nodes are, and the entry is found
+ *              with @ref ES_RBT_NODE_ENTRY. The order of nodes is given by a
+ *              caller supplied compare function. Insert, remove and lower
+ *              bound search take logarithmic time and the leftmost (smallest)
+ *              node is cached, so it is available in constant time.
+ *
+ *              Nodes which compare equal are allowed, a new node is placed
+ *              after the existing equal nodes.
+ * @{ *//*--------------------------------------------------------------------*/
+
+#ifndef ES_RBTREE_H_
+#define ES_RBTREE_H_
+
+/*=========================================================  INCLUDE FILES  ==*/
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stddef.h>
+
+#include "plat/compiler.h"
+#include "base/debug.h"
+
+/*===============================================================  MACRO's  ==*/
+
+/**@brief       Get the entry node pointer
+ * @param       typeOfNode
+ *              Type of node entry
+ * @param       tree
+ *              Name of tree node member in the entry
+ * @param       node
+ *              Pointer to the tree node
+ * @api
+ */
+#define ES_RBT_NODE_ENTRY(typeOfNode, tree, node)                               \
+    ((typeOfNode *)((char *)(node) - offsetof(typeOfNode, tree)))
+
+/*------------------------------------------------------  C++ extern begin  --*/
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*============================================================  DATA TYPES  ==*/
+
+/**@brief       Red-black tree node
+ * @api
+ */
+struct esRbtNode {
+    struct esRbtNode *  parent;                                                 /**<@brief Parent node, NULL for root                       */
+    struct esRbtNode *  left;                                                   /**<@brief Left child, smaller nodes                        */
+    struct esRbtNode *  right;                                                  /**<@brief Right child, greater or equal nodes              */
+    uint_fast8_t        color;                                                  /**<@brief Node color                                       */
+};
+
+/**@brief       Red-black tree node type
+ * @api
+ */
+typedef struct esRbtNode esRbtNode;
+
+/**@brief       Compare function
+ * @param       node
+ *              Pointer to the first node
+ * @param       other
+ *              Pointer to the second node
+ * @return      Negative value when @c node is less than @c other, zero when
+ *              they are equal and positive value otherwise
+ * @api
+ */
+typedef int (* esRbtCompare)(const struct esRbtNode * node, const struct esRbtNode * other);
+
+/**@brief       Red-black tree
+ * @api
+ */
+struct esRbt {
+    struct esRbtNode *  root;                                                   /**<@brief Root node                                        */
+    struct esRbtNode *  leftmost;                                               /**<@brief The smallest node                                */
+    esRbtCompare        compare;                                                /**<@brief Compare function                                 */
+#if   (1 == CONFIG_API_VALIDATION) || defined(__DOXYGEN__)
+    esAtomic            signature;                                              /**<@brief Red-black tree structure signature.              */
+#endif
+};
+
+/**@brief       Red-black tree type
+ * @api
+ */
+typedef struct esRbt esRbt;
+
+/*======================================================  GLOBAL VARIABLES  ==*/
+/*===================================================  FUNCTION PROTOTYPES  ==*/
+
+/**@brief       Initialize red-black tree
+ * @param       tree
+ *              Pointer to red-black tree
+ * @param       compare
+ *              Compare function which orders the nodes
+ * @api
+ */
+void esRbtInit(
+    struct esRbt *      tree,
+    esRbtCompare        compare);
+
+void esRbtTerm(
+    struct esRbt *      tree);
+
+/**@brief       Insert a node into the tree
+ * @param       tree
+ *              Pointer to red-black tree
+ * @param       node
+ *              Node to insert, it must not be in a tree
+ * @api
+ */
+void esRbtInsert(
+    struct esRbt *      tree,
+    struct esRbtNode *  node);
+
+/**@brief       Remove a node from the tree
+ * @param       tree
+ *              Pointer to red-black tree
+ * @param       node
+ *              Node to remove, it must be in this tree
+ * @api
+ */
+void esRbtRemove(
+    struct esRbt *      tree,
+    struct esRbtNode *  node);
+
+/**@brief       Find the first node which is not less than the key
+ * @param       tree
+ *              Pointer to red-black tree
+ * @param       key
+ *              Node which holds the key, usually a node of a temporary entry.
+ *              It is passed to compare function as @c other argument.
+ * @return      Pointer to the found node
+ *  @retval     NULL - all nodes are less than the key
+ * @api
+ */
+struct esRbtNode * esRbtLowerBound(
+    const struct esRbt * tree,
+    const struct esRbtNode * key);
+
+/**@brief       Get the next node in order
+ * @return      Pointer to the next node, NULL when @c node is the last one
+ * @api
+ */
+struct esRbtNode * esRbtNext(
+    const struct esRbtNode * node);
+
+/**@brief       Get the previous node in order
+ * @return      Pointer to the previous node, NULL when @c node is the first one
+ * @api
+ */
+struct esRbtNode * esRbtPrev(
+    const struct esRbtNode * node);
+
+/**@brief       Get the smallest node
+ * @return      Pointer to the smallest node, NULL when the tree is empty
+ * @api
+ */
+static PORT_C_INLINE struct esRbtNode * esRbtFirst(
+    const struct esRbt * tree) {
+
+    return (tree->leftmost);
+}
+
+static PORT_C_INLINE bool esRbtIsEmpty(
+    const struct esRbt * tree) {
+
+    if (tree->root == NULL) {
+
+        return (true);
+    } else {
+
+        return (false);
+    }
+}
+
+/*--------------------------------------------------------  C++ extern end  --*/
+#ifdef __cplusplus
+}
+#endif
+
+/*================================*//** @cond *//*==  CONFIGURATION ERRORS  ==*/
+/** @endcond *//** @} *//** @} *//*********************************************
+ * END of rbtree.h
+ ******************************************************************************/
+#endif /* ES_RBTREE_H_ */
@@ -0,0 +1,295 @@
+/*
+ * This file is part of eSolid.
+ *
+ * Copyright (C) 2010 - 2013 Nenad Radulovic
+ *
+ * eSolid is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * eSolid is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with eSolid.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * web site:    http://github.com/nradulovic
+ * e-mail  :    nenad.b.radulovic@gmail.com
+ *//***********************************************************************//**
+ * @file
+ * @author      Nenad Radulovic
+ * @brief       Unrolled linked list header
+ * @defgroup    base_unrolled_list Unrolled linked list
+ * @brief       Unrolled linked list
+ *********************************************************************//** @{ */
+/**@defgroup    base_unrolled_list_intf Interface
+ * @brief       Unrolled linked list API
+ * @details     Unrolled linked list stores item pointers in small arrays which
+ *              are linked into a @ref esDls list. One list node occupies
+ *              @ref CONFIG_ULL_NODE_SIZE bytes, so a sequential scan touches
+ *              one cache line per several items instead of one cache line per
+ *              item.
+ *
+ *              A full node is split in two halves on insert. When a node gets
+ *              less than half full on remove, it takes items from the next
+ *              node or it is merged with the next node. Both operations move
+ *              at most one node worth of items, so insert and remove take
+ *              constant time once the position is known. Nodes are allocated
+ *              through @ref esAllocator, which should return memory aligned
+ *              to cache line size.
+ *
+ *              Example of a scan:
+ * @code
+ *              struct esUllIter iter;
+ *
+ *              for (esUllIterBegin(&list, &iter); esUllIterIsValid(&list, &iter);
+ *                  esUllIterNext(&iter)) {
+ *                  process(esUllIterItem(&iter));
+ *              }
+ * @endcode
+ * @{ *//*--------------------------------------------------------------------*/
+
+#ifndef ES_UNROLLED_LIST_H_
+#define ES_UNROLLED_LIST_H_
+
+/*=========================================================  INCLUDE FILES  ==*/
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stddef.h>
+
+#include "plat/compiler.h"
+#include "base/debug.h"
+#include "base/error.h"
+#include "base/list.h"
+#include "base/allocator.h"
+
+/*===============================================================  MACRO's  ==*/
+
+/**@brief       Number of items in one list node
+ */
+#define ES_ULL_NODE_ITEMS                                                       \
+    ((CONFIG_ULL_NODE_SIZE - sizeof(struct esDls) - sizeof(size_t)) / sizeof(void *))
+
+/*==============================================================  SETTINGS  ==*/
+
+/**@brief       Size of one list node in bytes
+ * @details     Use a multiple of cache line size. The value must be at least
+ *              64 bytes.
+ */
+#if !defined(CONFIG_ULL_NODE_SIZE)
+# define CONFIG_ULL_NODE_SIZE           128u
+#endif
+
+/*------------------------------------------------------  C++ extern begin  --*/
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*============================================================  DATA TYPES  ==*/
+
+/**@brief       Unrolled list node
+ * @notapi
+ */
+struct esUllNode {
+    struct esDls        list;                                                   /**<@brief List of nodes                                    */
+    size_t              count;                                                  /**<@brief Number of items in this node                     */
+    void *              item[ES_ULL_NODE_ITEMS];                                /**<@brief Items                                            */
+};
+
+/**@brief       Unrolled linked list
+ * @api
+ */
+struct esUll {
+    struct esDls        nodes;                                                  /**<@brief Sentinel of node list                            */
+    size_t              count;                                                  /**<@brief Number of items                                  */
+    const struct esAllocator * allocator;                                       /**<@brief Allocator of nodes                               */
+#if   (1 == CONFIG_API_VALIDATION) || defined(__DOXYGEN__)
+    esAtomic            signature;                                              /**<@brief Unrolled list structure signature.               */
+#endif
+};
+
+/**@brief       Unrolled linked list type
+ * @api
+ */
+typedef struct esUll esUll;
+
+/**@brief       Unrolled linked list position
+ * @details     A position is invalidated by insert or remove made through any
+ *              other position.
+ * @api
+ */
+struct esUllIter {
+    struct esDls *      node;                                                   /**<@brief Current node, sentinel at the end of list        */
+    size_t              index;                                                  /**<@brief Item index in the current node                   */
+};
+
+/**@brief       Unrolled linked list position type
+ * @api
+ */
+typedef struct esUllIter esUllIter;
+
+/*======================================================  GLOBAL VARIABLES  ==*/
+/*===================================================  FUNCTION PROTOTYPES  ==*/
+
+/**@brief       Initialize unrolled list
+ * @param       ull
+ *              Pointer to unrolled list
+ * @param       allocator
+ *              Allocator of list nodes
+ * @api
+ */
+void esUllInit(
+    struct esUll *      ull,
+    const struct esAllocator * allocator);
+
+/**@brief       Terminate unrolled list and free all list nodes
+ * @details     The items are not touched.
+ * @api
+ */
+void esUllTerm(
+    struct esUll *      ull);
+
+/**@brief       Append an item to the end of list
+ * @param       ull
+ *              Pointer to unrolled list
+ * @param       item
+ *              Item to append
+ * @return      Operation status
+ *  @retval     ES_ERROR_NONE - the item is appended
+ *  @retval     ES_ERROR_NO_MEMORY - a new list node can not be allocated
+ * @api
+ */
+esError esUllPushBack(
+    struct esUll *      ull,
+    void *              item);
+
+/**@brief       Insert an item before the given position
+ * @param       ull
+ *              Pointer to unrolled list
+ * @param       iter
+ *              Position of insertion. At the end of list the item is appended.
+ *              On success the position points to the inserted item.
+ * @param       item
+ *              Item to insert
+ * @return      Operation status
+ *  @retval     ES_ERROR_NONE - the item is inserted
+ *  @retval     ES_ERROR_NO_MEMORY - a new list node can not be allocated
+ * @api
+ */
+esError esUllInsert(
+    struct esUll *      ull,
+    struct esUllIter *  iter,
+    void *              item);
+
+/**@brief       Remove the item at the given position
+ * @param       ull
+ *              Pointer to unrolled list
+ * @param       iter
+ *              Position of the item to remove. On return it points to the item
+ *              which followed the removed item.
+ * @api
+ */
+void esUllRemove(
+    struct esUll *      ull,
+    struct esUllIter *  iter);
+
+/**@brief       Set the position to the first item in list
+ * @api
+ */
+static PORT_C_INLINE void esUllIterBegin(
+    const struct esUll * ull,
+    struct esUllIter *  iter) {
+
+    iter->node  = ull->nodes.next;
+    iter->index = 0u;
+}
+
+/**@brief       Is the position before the end of list?
+ * @api
+ */
+static PORT_C_INLINE bool esUllIterIsValid(
+    const struct esUll * ull,
+    const struct esUllIter * iter) {
+
+    if (iter->node != &ull->nodes) {
+
+        return (true);
+    } else {
+
+        return (false);
+    }
+}
+
+/**@brief       Move the position to the next item
+ * @details     The list never contains empty nodes, so the next node always
+ *              starts with an item or it is the sentinel.
+ * @api
+ */
+static PORT_C_INLINE void esUllIterNext(
+    struct esUllIter *  iter) {
+
+    iter->index++;
+
+    if (iter->index == ES_DLS_NODE_ENTRY(struct esUllNode, list, iter->node)->count) {
+        iter->node  = iter->node->next;
+        iter->index = 0u;
+    }
+}
+
+/**@brief       Get the item at the given position
+ * @api
+ */
+static PORT_C_INLINE void * esUllIterItem(
+    const struct esUllIter * iter) {
+
+    return (ES_DLS_NODE_ENTRY(struct esUllNode, list, iter->node)->item[iter->index]);
+}
+
+static PORT_C_INLINE esError esUllPushFront(
+    struct esUll *      ull,
+    void *              item) {
+
+    struct esUllIter    iter;
+
+    esUllIterBegin(ull, &iter);
+
+    return (esUllInsert(ull, &iter, item));
+}
+
+static PORT_C_INLINE size_t esUllCount(
+    const struct esUll * ull) {
+
+    return (ull->count);
+}
+
+static PORT_C_INLINE bool esUllIsEmpty(
+    const struct esUll * ull) {
+
+    if (ull->count == 0u) {
+
+        return (true);
+    } else {
+
+        return (false);
+    }
+}
+
+/*--------------------------------------------------------  C++ extern end  --*/
+#ifdef __cplusplus
+}
+#endif
+
+/*================================*//** @cond *//*==  CONFIGURATION ERRORS  ==*/
+
+#if (CONFIG_ULL_NODE_SIZE < 64u)
+# error "eSolid RT Kernel: Configuration option CONFIG_ULL_NODE_SIZE is out of range."
+#endif
+
+/** @endcond *//** @} *//** @} *//*********************************************
+ * END of unrolled_list.h
+ ******************************************************************************/
+#endif /* ES_UNROLLED_LIST_H_ */
@@ -87,6 +87,17 @@
  */
 #define PORT_C_ALIGN(align)             __attribute__((aligned (align)))
 
+/**@brief       Prefetch the memory at given address into data cache
+ * @details     On cores without data cache the preload hint executes as no
+ *              operation.
+ */
+#define PORT_C_PREFETCH(addr)           __builtin_prefetch((addr))
+
+/**@brief       Number of nodes ahead of the current node which are prefetched
+ *              by list iteration macros, 1 or 2
+ */
+#define PORT_C_PREFETCH_DISTANCE        1u
+
 /**@brief       A standardized way of properly setting the value of HW register
  * @param       reg
  *              Register which will be written to
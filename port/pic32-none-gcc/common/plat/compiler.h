@@ -87,6 +87,17 @@
  */
 #define PORT_C_ALIGN(align)             __attribute__((aligned (align)))
 
+/**@brief       Prefetch the memory at given address into data cache
+ * @details     This port has no data cache worth prefetching into, so the
+ *              macro does nothing.
+ */
+#define PORT_C_PREFETCH(addr)           ((void)(addr))
+
+/**@brief       Number of nodes ahead of the current node which are prefetched
+ *              by list iteration macros, 1 or 2
+ */
+#define PORT_C_PREFETCH_DISTANCE        1u
+
 /**@brief       A standardized way of properly setting the value of HW register
  * @param       reg
  *              Register which will be written to
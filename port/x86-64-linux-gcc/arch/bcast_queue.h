@@ -0,0 +1,256 @@
+/*
+ * This file is part of eSolid.
+ *
+ * Copyright (C) 2010 - 2013 Nenad Radulovic
+ *
+ * eSolid is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * eSolid is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with eSolid.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * web site:    http://github.com/nradulovic
+ * e-mail  :    nenad.b.radulovic@gmail.com
+ *//***********************************************************************//**
+ * @file
+ * @author      Nenad Radulovic
+ * @brief       Interface of broadcast pointer queue port.
+ * @addtogroup  x86-64-linux-gcc
+ *********************************************************************//** @{ */
+/**@defgroup    x86-64-linux-gcc-bcast_queue Broadcast pointer queue
+ * @brief       Broadcast pointer queue
+ * @details     Broadcast queue is a single producer ring where every attached
+ *              reader sees every item. Each reader has its own sequence cursor
+ *              and the producer is gated by the slowest reader, so one put
+ *              makes an item visible to all readers without copying it into
+ *              per-reader queues. A reader can process all published items in
+ *              one batch and then consume them with a single cursor update.
+ *
+ *              Readers must be attached and detached while the producer is
+ *              not putting items. The item memory must stay valid until all
+ *              readers have consumed it.
+ * @{ *//*--------------------------------------------------------------------*/
+
+#ifndef ES_ARCH_BCAST_QUEUE_H_
+#define ES_ARCH_BCAST_QUEUE_H_
+
+/*=========================================================  INCLUDE FILES  ==*/
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stddef.h>
+
+#include "plat/compiler.h"
+#include "base/debug.h"
+
+/*===============================================================  MACRO's  ==*/
+
+/**@brief       Size of CPU cache line used to separate producer and reader
+ *              data
+ */
+#define ES_QP_BCAST_CACHE_LINE          64u
+
+/*==============================================================  SETTINGS  ==*/
+
+/**@brief       Maximum number of readers attached to one broadcast queue
+ */
+#if !defined(CONFIG_QP_BCAST_READERS)
+# define CONFIG_QP_BCAST_READERS        8u
+#endif
+
+/*------------------------------------------------------  C++ extern begin  --*/
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*============================================================  DATA TYPES  ==*/
+
+/**@brief       Broadcast queue reader
+ * @api
+ */
+struct esQpBcastReader {
+    uint64_t            cursor PORT_C_ALIGN(ES_QP_BCAST_CACHE_LINE);            /**<@brief Sequence of the next item to read                */
+    struct esQpBcast *  queue;                                                  /**<@brief The queue this reader is attached to             */
+};
+
+/**@brief       Broadcast queue reader type
+ * @api
+ */
+typedef struct esQpBcastReader esQpBcastReader;
+
+/**@brief       Broadcast queue
+ * @api
+ */
+struct esQpBcast {
+    void **             buff;                                                   /**<@brief Queue buffer                                     */
+    uint64_t            mask;                                                   /**<@brief Size of buffer minus one                         */
+    struct esQpBcastReader * reader[CONFIG_QP_BCAST_READERS];                   /**<@brief Attached readers                                 */
+    uint_fast8_t        readers;                                                /**<@brief Number of attached readers                       */
+    uint64_t            gating;                                                 /**<@brief Cached cursor of the slowest reader              */
+    uint64_t            published PORT_C_ALIGN(ES_QP_BCAST_CACHE_LINE);         /**<@brief Sequence of the next item to put                 */
+};
+
+/**@brief       Broadcast queue type
+ * @api
+ */
+typedef struct esQpBcast esQpBcast;
+
+/*======================================================  GLOBAL VARIABLES  ==*/
+/*===================================================  FUNCTION PROTOTYPES  ==*/
+
+/**@brief       Initialize broadcast queue
+ * @param       bq
+ *              Pointer to broadcast queue
+ * @param       buff
+ *              Queue buffer, see @ref ES_QP_SIZEOF
+ * @param       size
+ *              Number of elements in buffer, must be a power of two
+ * @api
+ */
+void esQpBcastInit(
+    struct esQpBcast *  bq,
+    void **             buff,
+    size_t              size);
+
+void esQpBcastTerm(
+    struct esQpBcast *  bq);
+
+/**@brief       Attach a reader to the queue
+ * @param       bq
+ *              Pointer to broadcast queue
+ * @param       reader
+ *              Pointer to reader. The reader will see only items which are
+ *              put after this call.
+ * @api
+ */
+void esQpBcastAttach(
+    struct esQpBcast *  bq,
+    struct esQpBcastReader * reader);
+
+void esQpBcastDetach(
+    struct esQpBcastReader * reader);
+
+/**@brief       Recalculate the cursor of the slowest reader
+ * @notapi
+ */
+uint64_t esQpBcastGating_(
+    struct esQpBcast *  bq);
+
+/**@brief       Put an item into the queue
+ * @param       bq
+ *              Pointer to broadcast queue
+ * @param       item
+ *              Item to put
+ * @return      Was the item put into the queue?
+ *  @retval     true - the item is visible to all readers
+ *  @retval     false - the slowest reader has not consumed the oldest item
+ * @api
+ */
+static PORT_C_INLINE bool esQpBcastPutItem(
+    struct esQpBcast *  bq,
+    void *              item) {
+
+    uint64_t            seq;
+
+    seq = bq->published;
+
+    if ((seq - bq->gating) > bq->mask) {                                        /* Is the queue full for the cached slowest reader?         */
+
+        if ((seq - esQpBcastGating_(bq)) > bq->mask) {
+
+            return (false);
+        }
+    }
+    bq->buff[seq & bq->mask] = item;
+    __atomic_store_n(&bq->published, seq + 1u, __ATOMIC_RELEASE);
+
+    return (true);
+}
+
+/**@brief       Get the number of items available to reader
+ * @param       reader
+ *              Pointer to reader
+ * @return      Number of published items which the reader has not consumed
+ * @api
+ */
+static PORT_C_INLINE size_t esQpBcastAvailable(
+    const struct esQpBcastReader * reader) {
+
+    return ((size_t)(__atomic_load_n(&reader->queue->published, __ATOMIC_ACQUIRE) -
+        reader->cursor));
+}
+
+/**@brief       Peek at an item available to reader
+ * @param       reader
+ *              Pointer to reader
+ * @param       index
+ *              Index of item, must be less than @ref esQpBcastAvailable
+ * @return      The item
+ * @api
+ */
+static PORT_C_INLINE void * esQpBcastItemAt(
+    const struct esQpBcastReader * reader,
+    size_t              index) {
+
+    return (reader->queue->buff[(reader->cursor + index) & reader->queue->mask]);
+}
+
+/**@brief       Consume items
+ * @param       reader
+ *              Pointer to reader
+ * @param       count
+ *              Number of items to consume
+ * @details     Consumed slots become available to the producer once all other
+ *              readers have consumed them, too.
+ * @api
+ */
+static PORT_C_INLINE void esQpBcastConsume(
+    struct esQpBcastReader * reader,
+    size_t              count) {
+
+    ES_API_REQUIRE_A(ES_API_RANGE, count <= esQpBcastAvailable(reader));
+
+    __atomic_store_n(&reader->cursor, reader->cursor + count, __ATOMIC_RELEASE);
+}
+
+/**@brief       Get the next item
+ * @param       reader
+ *              Pointer to reader
+ * @param       item
+ *              Pointer to variable which will receive the item
+ * @return      Was an item available?
+ * @api
+ */
+static PORT_C_INLINE bool esQpBcastGetItem(
+    struct esQpBcastReader * reader,
+    void **             item) {
+
+    if (esQpBcastAvailable(reader) == 0u) {
+
+        return (false);
+    }
+    *item = esQpBcastItemAt(reader, 0u);
+    esQpBcastConsume(
+        reader,
+        1u);
+
+    return (true);
+}
+
+/*--------------------------------------------------------  C++ extern end  --*/
+#ifdef __cplusplus
+}
+#endif
+
+/*================================*//** @cond *//*==  CONFIGURATION ERRORS  ==*/
+/** @endcond *//** @} *//******************************************************
+ * END of bcast_queue.h
+ ******************************************************************************/
+#endif /* ES_ARCH_BCAST_QUEUE_H_ */
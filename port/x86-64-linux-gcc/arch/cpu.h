@@ -60,7 +60,7 @@
 
 /**@brief       Compute power of 2
  */
-#define ES_CPU_PWR2(pwr)                (0x01u << (pwr))
+#define ES_CPU_PWR2(pwr)                (0x01ul << (pwr))
 
 /**@} *//*----------------------------------------------------------------*//**
  * @name        Generic port macros
@@ -95,7 +95,7 @@ typedef unsigned int esCpuReg;
 /**
  * @brief       Find last set bit in a word
  * @param       value
- *              32 bit value which will be evaluated
+ *              64 bit value which will be evaluated
  * @return      Last set bit in a word
  * @details     This implementation uses @c clz instruction and then it computes
  *              the result using the following expression:
@@ -106,7 +106,7 @@ static PORT_C_INLINE_ALWAYS uint_fast8_t portCpuFls_(
     esAtomic            value) {
 
 
-    return ((uint_fast8_t)(31u - (unsigned int)__builtin_clz(value)));
+    return ((uint_fast8_t)(63u - (unsigned int)__builtin_clzl(value)));
 }
 
 /** @} *//*---------------------------------------------------------------*//**
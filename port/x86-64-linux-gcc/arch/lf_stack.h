@@ -0,0 +1,218 @@
+/*
+ * This file is part of eSolid.
+ *
+ * Copyright (C) 2010 - 2013 Nenad Radulovic
+ *
+ * eSolid is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * eSolid is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with eSolid.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * web site:    http://github.com/nradulovic
+ * e-mail  :    nenad.b.radulovic@gmail.com
+ *//***********************************************************************//**
+ * @file
+ * @author      Nenad Radulovic
+ * @brief       Interface of lock-free stack port.
+ * @addtogroup  x86-64-linux-gcc
+ *********************************************************************//** @{ */
+/**@defgroup    x86-64-linux-gcc-lf_stack Lock-free stack
+ * @brief       Lock-free stack
+ * @details     Treiber stack of @ref esSls nodes which may be pushed and popped
+ *              by any number of threads without locks. The stack head holds
+ *              the top node pointer and a tag which changes on every pop. Both
+ *              are replaced by one double width compare and swap
+ *              (cmpxchg16b), so a pop does not succeed when the top node was
+ *              popped and pushed again meanwhile (ABA problem).
+ *
+ *              Nodes in the stack are linked by @c next pointer and the last
+ *              node points to NULL. A popped node may be read by another
+ *              thread which is about to lose its compare and swap, so node
+ *              memory must stay mapped while the stack is in use, as it is
+ *              for free lists and memory pools.
+ * @{ *//*--------------------------------------------------------------------*/
+
+#ifndef ES_ARCH_LF_STACK_H_
+#define ES_ARCH_LF_STACK_H_
+
+/*=========================================================  INCLUDE FILES  ==*/
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stddef.h>
+
+#include "plat/compiler.h"
+#include "base/list.h"
+
+/*===============================================================  MACRO's  ==*/
+/*------------------------------------------------------  C++ extern begin  --*/
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*============================================================  DATA TYPES  ==*/
+
+/**@brief       Lock-free stack
+ * @details     The structure is aligned to 16 bytes as required by
+ *              cmpxchg16b instruction.
+ * @api
+ */
+struct esLfs {
+    struct esSls *      top PORT_C_ALIGN(16);                                   /**<@brief Top node or NULL when empty                      */
+    uintptr_t           tag;                                                    /**<@brief Incremented on every pop                         */
+};
+
+/**@brief       Lock-free stack type
+ * @api
+ */
+typedef struct esLfs esLfs;
+
+/*======================================================  GLOBAL VARIABLES  ==*/
+/*===================================================  FUNCTION PROTOTYPES  ==*/
+
+/**@brief       Compare and swap the stack head
+ * @param       lfs
+ *              Pointer to lock-free stack
+ * @param       expected
+ *              Pointer to expected head. When the swap fails it receives the
+ *              current head.
+ * @param       top
+ *              New top node
+ * @param       tag
+ *              New tag
+ * @return      Was the head swapped?
+ * @notapi
+ */
+static PORT_C_INLINE bool esLfsCas_(
+    struct esLfs *      lfs,
+    struct esLfs *      expected,
+    struct esSls *      top,
+    uintptr_t           tag) {
+
+    bool                isSwapped;
+
+    __asm__ __volatile__(
+        "lock cmpxchg16b %1\n\t"
+        "setz %0"
+        : "=q"(isSwapped), "+m"(*lfs), "+a"(expected->top), "+d"(expected->tag)
+        : "b"(top), "c"(tag)
+        : "cc", "memory");
+
+    return (isSwapped);
+}
+
+/**@brief       Read the stack head
+ * @details     The two halves are read separately, a torn value only makes the
+ *              following compare and swap fail and return the current head.
+ * @notapi
+ */
+static PORT_C_INLINE void esLfsLoad_(
+    struct esLfs *      lfs,
+    struct esLfs *      head) {
+
+    head->tag = __atomic_load_n(&lfs->tag, __ATOMIC_ACQUIRE);
+    head->top = __atomic_load_n(&lfs->top, __ATOMIC_ACQUIRE);
+}
+
+static PORT_C_INLINE void esLfsInit(
+    struct esLfs *      lfs) {
+
+    lfs->top = NULL;
+    lfs->tag = 0u;
+}
+
+/**@brief       Push a node on the stack
+ * @param       lfs
+ *              Pointer to lock-free stack
+ * @param       node
+ *              Node to push
+ * @api
+ */
+static PORT_C_INLINE void esLfsPush(
+    struct esLfs *      lfs,
+    struct esSls *      node) {
+
+    struct esLfs        head;
+
+    esLfsLoad_(lfs, &head);
+
+    do {
+        node->next = head.top;
+    } while (esLfsCas_(lfs, &head, node, head.tag) == false);
+}
+
+/**@brief       Pop the top node from the stack
+ * @param       lfs
+ *              Pointer to lock-free stack
+ * @return      Pointer to the popped node
+ *  @retval     NULL - the stack is empty
+ * @api
+ */
+static PORT_C_INLINE struct esSls * esLfsPop(
+    struct esLfs *      lfs) {
+
+    struct esLfs        head;
+
+    esLfsLoad_(lfs, &head);
+
+    do {
+
+        if (head.top == NULL) {
+
+            return (NULL);
+        }
+    } while (esLfsCas_(lfs, &head, __atomic_load_n(&head.top->next, __ATOMIC_RELAXED), head.tag + 1u) == false);
+
+    return (head.top);
+}
+
+/**@brief       Pop all nodes from the stack
+ * @param       lfs
+ *              Pointer to lock-free stack
+ * @return      Pointer to the top node of popped list, nodes are linked from
+ *              the newest to the oldest and the last one points to NULL
+ *  @retval     NULL - the stack is empty
+ * @api
+ */
+static PORT_C_INLINE struct esSls * esLfsPopAll(
+    struct esLfs *      lfs) {
+
+    struct esLfs        head;
+
+    esLfsLoad_(lfs, &head);
+
+    do {
+
+        if (head.top == NULL) {
+
+            return (NULL);
+        }
+    } while (esLfsCas_(lfs, &head, NULL, head.tag + 1u) == false);
+
+    return (head.top);
+}
+
+static PORT_C_INLINE bool esLfsIsEmpty(
+    struct esLfs *      lfs) {
+
+    return ((__atomic_load_n(&lfs->top, __ATOMIC_RELAXED) == NULL) ? true : false);
+}
+
+/*--------------------------------------------------------  C++ extern end  --*/
+#ifdef __cplusplus
+}
+#endif
+
+/*================================*//** @cond *//*==  CONFIGURATION ERRORS  ==*/
+/** @endcond *//** @} *//******************************************************
+ * END of lf_stack.h
+ ******************************************************************************/
+#endif /* ES_ARCH_LF_STACK_H_ */
@@ -0,0 +1,113 @@
+/*
+ * This file is part of eSolid.
+ *
+ * Copyright (C) 2010 - 2013 Nenad Radulovic
+ *
+ * eSolid is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * eSolid is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with eSolid.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * web site:    http://github.com/nradulovic
+ * e-mail  :    nenad.b.radulovic@gmail.com
+ *//***********************************************************************//**
+ * @file
+ * @author      Nenad Radulovic
+ * @brief       Interface of mirrored memory buffer port.
+ * @addtogroup  x86-64-linux-gcc
+ *********************************************************************//** @{ */
+/**@defgroup    x86-64-linux-gcc-mirror Mirrored memory buffer
+ * @brief       Mirrored memory buffer
+ * @details     Mirrored buffer storage is mapped twice, back to back, in
+ *              virtual memory. Any access which starts inside the buffer and
+ *              is not longer than the buffer size is contiguous, even if it
+ *              crosses the end of buffer. The storage can be used by byte
+ *              record queue, see @ref esQbInitMirrored.
+ * @{ *//*--------------------------------------------------------------------*/
+
+#ifndef ES_ARCH_MIRROR_H_
+#define ES_ARCH_MIRROR_H_
+
+/*=========================================================  INCLUDE FILES  ==*/
+
+#include <stddef.h>
+
+#include "plat/compiler.h"
+#include "base/error.h"
+
+/*===============================================================  MACRO's  ==*/
+/*------------------------------------------------------  C++ extern begin  --*/
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*============================================================  DATA TYPES  ==*/
+
+/**@brief       Mirrored buffer structure
+ * @api
+ */
+struct esMirror {
+    void *              base;                                                   /**<@brief Start of the first mapping                       */
+    size_t              size;                                                   /**<@brief Size of one mapping                              */
+};
+
+/**@brief       Mirrored buffer type
+ * @api
+ */
+typedef struct esMirror esMirror;
+
+/*======================================================  GLOBAL VARIABLES  ==*/
+/*===================================================  FUNCTION PROTOTYPES  ==*/
+
+/**@brief       Create mirrored buffer
+ * @param       mirror
+ *              Pointer to mirrored buffer structure
+ * @param       size
+ *              Size of the buffer, must be a multiple of the page size
+ * @return      Operation status
+ *  @retval     ES_ERROR_NONE - buffer was created
+ *  @retval     ES_ERROR_NO_MEMORY - failed to create the mappings
+ * @api
+ */
+esError esMirrorInit(
+    struct esMirror *   mirror,
+    size_t              size);
+
+/**@brief       Destroy mirrored buffer
+ * @param       mirror
+ *              Pointer to mirrored buffer structure
+ * @api
+ */
+void esMirrorTerm(
+    struct esMirror *   mirror);
+
+static PORT_C_INLINE void * esMirrorBase(
+    const struct esMirror * mirror) {
+
+    return (mirror->base);
+}
+
+static PORT_C_INLINE size_t esMirrorSize(
+    const struct esMirror * mirror) {
+
+    return (mirror->size);
+}
+
+/*--------------------------------------------------------  C++ extern end  --*/
+#ifdef __cplusplus
+}
+#endif
+
+/*================================*//** @cond *//*==  CONFIGURATION ERRORS  ==*/
+/** @endcond *//** @} *//******************************************************
+ * END of mirror.h
+ ******************************************************************************/
+#endif /* ES_ARCH_MIRROR_H_ */
@@ -0,0 +1,175 @@
+/*
+ * This file is part of eSolid.
+ *
+ * Copyright (C) 2010 - 2013 Nenad Radulovic
+ *
+ * eSolid is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * eSolid is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with eSolid.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * web site:    http://github.com/nradulovic
+ * e-mail  :    nenad.b.radulovic@gmail.com
+ *//***********************************************************************//**
+ * @file
+ * @author      Nenad Radulovic
+ * @brief       Interface of queue readiness notifier port.
+ * @addtogroup  x86-64-linux-gcc
+ *********************************************************************//** @{ */
+/**@defgroup    x86-64-linux-gcc-queue_notify Queue readiness notifier
+ * @brief       Queue readiness notifier
+ * @details     Notifier is an eventfd descriptor which becomes readable when
+ *              an attached queue transitions from empty to non-empty state.
+ *              The descriptor can be added to an @c epoll set together with
+ *              sockets. Notifications are coalesced: once the descriptor is
+ *              signalled, further puts do not touch it until the consumer
+ *              acknowledges the notification with @ref esQNotifyAck.
+ *
+ *              Consumer loop:
+ *              - wait in @c epoll_wait() for the notifier descriptor,
+ *              - call @ref esQNotifyAck,
+ *              - drain the queue until it is empty.
+ *
+ *              Queue access itself must be serialized by the caller as for
+ *              any other @ref esQp or @ref esPq operation.
+ * @{ *//*--------------------------------------------------------------------*/
+
+#ifndef ES_ARCH_QUEUE_NOTIFY_H_
+#define ES_ARCH_QUEUE_NOTIFY_H_
+
+/*=========================================================  INCLUDE FILES  ==*/
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "plat/compiler.h"
+#include "base/error.h"
+#include "base/queue.h"
+#include "base/prio_queue.h"
+
+/*===============================================================  MACRO's  ==*/
+/*------------------------------------------------------  C++ extern begin  --*/
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*============================================================  DATA TYPES  ==*/
+
+/**@brief       Queue readiness notifier
+ * @api
+ */
+struct esQNotify {
+    int                 fd;                                                     /**<@brief eventfd descriptor                               */
+    uint32_t            isSignalled;                                            /**<@brief Descriptor is signalled and not acknowledged     */
+};
+
+/**@brief       Queue readiness notifier type
+ * @api
+ */
+typedef struct esQNotify esQNotify;
+
+/*======================================================  GLOBAL VARIABLES  ==*/
+/*===================================================  FUNCTION PROTOTYPES  ==*/
+
+/**@brief       Initialize notifier
+ * @param       notify
+ *              Pointer to notifier
+ * @return      Operation status
+ *  @retval     ES_ERROR_NONE - notifier is created
+ *  @retval     ES_ERROR_NO_RESOURCE - failed to create eventfd descriptor
+ * @api
+ */
+esError esQNotifyInit(
+    struct esQNotify *  notify);
+
+void esQNotifyTerm(
+    struct esQNotify *  notify);
+
+/**@brief       Signal the notifier descriptor
+ * @param       notify
+ *              Pointer to notifier
+ * @details     The descriptor is written only if it is not already signalled.
+ * @api
+ */
+void esQNotifySignal(
+    struct esQNotify *  notify);
+
+/**@brief       Acknowledge the notification
+ * @param       notify
+ *              Pointer to notifier
+ * @details     Consumer must call this function before it starts to drain the
+ *              queue. Items which are put while the queue is being drained
+ *              will signal the descriptor again, so no wake-up is lost.
+ * @api
+ */
+void esQNotifyAck(
+    struct esQNotify *  notify);
+
+static PORT_C_INLINE int esQNotifyFd(
+    const struct esQNotify * notify) {
+
+    return (notify->fd);
+}
+
+/**@brief       Put an item into pointer queue and signal on empty to non-empty
+ *              transition
+ * @api
+ */
+static PORT_C_INLINE void esQpPutItemNotify(
+    struct esQp *       qp,
+    struct esQNotify *  notify,
+    void *              item) {
+
+    bool                wasEmpty;
+
+    wasEmpty = esQpIsEmpty(qp);
+    esQpPutItem(
+        qp,
+        item);
+
+    if (wasEmpty == true) {
+        esQNotifySignal(
+            notify);
+    }
+}
+
+/**@brief       Add an element into priority queue and signal on empty to
+ *              non-empty transition
+ * @api
+ */
+static PORT_C_INLINE void esPqAddNotify(
+    struct esPq *       pq,
+    struct esQNotify *  notify,
+    struct esPqElem *   element) {
+
+    bool                wasEmpty;
+
+    wasEmpty = esPqIsEmpty(pq);
+    esPqAdd(
+        pq,
+        element);
+
+    if (wasEmpty == true) {
+        esQNotifySignal(
+            notify);
+    }
+}
+
+/*--------------------------------------------------------  C++ extern end  --*/
+#ifdef __cplusplus
+}
+#endif
+
+/*================================*//** @cond *//*==  CONFIGURATION ERRORS  ==*/
+/** @endcond *//** @} *//******************************************************
+ * END of queue_notify.h
+ ******************************************************************************/
+#endif /* ES_ARCH_QUEUE_NOTIFY_H_ */
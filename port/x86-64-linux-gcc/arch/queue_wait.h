@@ -0,0 +1,159 @@
+/*
+ * This file is part of eSolid.
+ *
+ * Copyright (C) 2010 - 2013 Nenad Radulovic
+ *
+ * eSolid is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * eSolid is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with eSolid.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * web site:    http://github.com/nradulovic
+ * e-mail  :    nenad.b.radulovic@gmail.com
+ *//***********************************************************************//**
+ * @file
+ * @author      Nenad Radulovic
+ * @brief       Interface of blocking pointer queue port.
+ * @addtogroup  x86-64-linux-gcc
+ *********************************************************************//** @{ */
+/**@defgroup    x86-64-linux-gcc-queue_wait Blocking pointer queue
+ * @brief       Blocking pointer queue
+ * @details     Single producer, single consumer pointer queue which can be
+ *              shared between two threads. Producer and consumer may block
+ *              when the queue is full or empty. A blocked thread first spins
+ *              for a short time and then it parks on a futex which is keyed to
+ *              the queue index it waits for. The other side makes a futex
+ *              system call only when a waiter is registered, so operations on
+ *              a queue without waiters make no system calls.
+ * @{ *//*--------------------------------------------------------------------*/
+
+#ifndef ES_ARCH_QUEUE_WAIT_H_
+#define ES_ARCH_QUEUE_WAIT_H_
+
+/*=========================================================  INCLUDE FILES  ==*/
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stddef.h>
+
+#include "plat/compiler.h"
+#include "base/error.h"
+
+/*===============================================================  MACRO's  ==*/
+
+/**@brief       Timeout value which means wait forever
+ * @api
+ */
+#define ES_QP_WAIT_FOREVER              UINT32_MAX
+
+/**@brief       Size of CPU cache line used to separate producer and consumer
+ *              data
+ */
+#define ES_QP_WAIT_CACHE_LINE           64u
+
+/*==============================================================  SETTINGS  ==*/
+
+/**@brief       Number of spin iterations before a thread parks on futex
+ */
+#if !defined(CONFIG_QP_WAIT_SPIN)
+# define CONFIG_QP_WAIT_SPIN            100u
+#endif
+
+/*------------------------------------------------------  C++ extern begin  --*/
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*============================================================  DATA TYPES  ==*/
+
+/**@brief       Blocking pointer queue
+ * @details     Indexes are free running, the position in buffer is obtained by
+ *              masking the index with <code>size - 1</code>.
+ * @api
+ */
+struct esQpWait {
+    void **             buff;                                                   /**<@brief Queue buffer                                     */
+    uint32_t            mask;                                                   /**<@brief Size of buffer minus one                         */
+    uint32_t            head PORT_C_ALIGN(ES_QP_WAIT_CACHE_LINE);               /**<@brief Producer index                                   */
+    uint32_t            getWaiters;                                             /**<@brief Number of consumers parked on head               */
+    uint32_t            tail PORT_C_ALIGN(ES_QP_WAIT_CACHE_LINE);               /**<@brief Consumer index                                   */
+    uint32_t            putWaiters;                                             /**<@brief Number of producers parked on tail               */
+};
+
+/**@brief       Blocking pointer queue type
+ * @api
+ */
+typedef struct esQpWait esQpWait;
+
+/*======================================================  GLOBAL VARIABLES  ==*/
+/*===================================================  FUNCTION PROTOTYPES  ==*/
+
+/**@brief       Initialize blocking pointer queue
+ * @param       qp
+ *              Pointer to blocking queue
+ * @param       buff
+ *              Queue buffer, see @ref ES_QP_SIZEOF
+ * @param       size
+ *              Number of elements in buffer, must be a power of two
+ * @api
+ */
+void esQpWaitInit(
+    struct esQpWait *   qp,
+    void **             buff,
+    size_t              size);
+
+void esQpWaitTerm(
+    struct esQpWait *   qp);
+
+/**@brief       Put an item into the queue, wait while the queue is full
+ * @param       qp
+ *              Pointer to blocking queue
+ * @param       item
+ *              Item to put
+ * @param       timeout
+ *              Timeout in milliseconds or @ref ES_QP_WAIT_FOREVER
+ * @return      Operation status
+ *  @retval     ES_ERROR_NONE - the item was put into the queue
+ *  @retval     ES_ERROR_TIMEOUT - the queue stayed full for @c timeout
+ * @api
+ */
+esError esQpPutWait(
+    struct esQpWait *   qp,
+    void *              item,
+    uint32_t            timeout);
+
+/**@brief       Get an item from the queue, wait while the queue is empty
+ * @param       qp
+ *              Pointer to blocking queue
+ * @param       item
+ *              Pointer to variable which will receive the item
+ * @param       timeout
+ *              Timeout in milliseconds or @ref ES_QP_WAIT_FOREVER
+ * @return      Operation status
+ *  @retval     ES_ERROR_NONE - an item was taken from the queue
+ *  @retval     ES_ERROR_TIMEOUT - the queue stayed empty for @c timeout
+ * @api
+ */
+esError esQpGetWait(
+    struct esQpWait *   qp,
+    void **             item,
+    uint32_t            timeout);
+
+/*--------------------------------------------------------  C++ extern end  --*/
+#ifdef __cplusplus
+}
+#endif
+
+/*================================*//** @cond *//*==  CONFIGURATION ERRORS  ==*/
+/** @endcond *//** @} *//******************************************************
+ * END of queue_wait.h
+ ******************************************************************************/
+#endif /* ES_ARCH_QUEUE_WAIT_H_ */
@@ -0,0 +1,341 @@
+/*
+ * This file is part of eSolid.
+ *
+ * Copyright (C) 2010 - 2013 Nenad Radulovic
+ *
+ * eSolid is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * eSolid is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with eSolid.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * web site:    http://github.com/nradulovic
+ * e-mail  :    nenad.b.radulovic@gmail.com
+ *//***********************************************************************//**
+ * @file
+ * @author      Nenad Radulovic
+ * @brief       Interface of read-copy-update list port.
+ * @addtogroup  x86-64-linux-gcc
+ *********************************************************************//** @{ */
+/**@defgroup    x86-64-linux-gcc-rcu_list Read-copy-update list
+ * @brief       Read-copy-update list
+ * @details     Read-copy-update (RCU) list is an @ref esDls list which is
+ *              traversed by readers without locks and without atomic
+ *              read-modify-write instructions. Writers, which must be
+ *              serialized by the caller, link new nodes with release stores
+ *              and unlink old nodes without touching their @c next pointers,
+ *              so a reader which stands on an unlinked node can still walk
+ *              back into the list.
+ *
+ *              An unlinked node may be freed only when every reader has passed
+ *              a quiescent state, which is a point where the reader holds no
+ *              references to list nodes. This implementation uses quiescent
+ *              state based reclamation: each reader thread registers a
+ *              @ref esRcuReader and periodically calls @ref esRcuQuiescent,
+ *              for example once per loop of the worker. The call is a plain
+ *              store to a reader private cache line, so read-side sections
+ *              themselves cost nothing. A reader which blocks for a long time
+ *              should go offline with @ref esRcuOffline first.
+ *
+ *              Writers hand unlinked nodes to @ref esRcuDefer and call
+ *              @ref esRcuSynchronize, which waits until all online readers
+ *              have passed a quiescent state and then reclaims the deferred
+ *              nodes.
+ * @{ *//*--------------------------------------------------------------------*/
+
+#ifndef ES_ARCH_RCU_LIST_H_
+#define ES_ARCH_RCU_LIST_H_
+
+/*=========================================================  INCLUDE FILES  ==*/
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stddef.h>
+#include <pthread.h>
+
+#include "plat/compiler.h"
+#include "base/list.h"
+
+/*===============================================================  MACRO's  ==*/
+
+/**@brief       Cache line size used to separate reader counters
+ */
+#define ES_RCU_CACHE_LINE               64u
+
+/**@brief       Traverse RCU list from a reader
+ * @param       sentinel
+ *              Pointer to list sentinel
+ * @param       node
+ *              Loop cursor, pointer to @ref esDls
+ * @details     Must be used between quiescent states of an online reader.
+ * @api
+ */
+#define ES_RCU_DLS_FOR_EACH(sentinel, node)                                     \
+    for ((node) = esRcuDlsNext(sentinel);                                       \
+         (node) != (sentinel);                                                  \
+         (node) = esRcuDlsNext(node))
+
+/*------------------------------------------------------  C++ extern begin  --*/
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*============================================================  DATA TYPES  ==*/
+
+/**@brief       RCU reader state
+ * @details     Each reader thread owns one structure.
+ * @api
+ */
+struct esRcuReader {
+    uint64_t            epoch PORT_C_ALIGN(ES_RCU_CACHE_LINE);                  /**<@brief Last seen epoch, zero when offline               */
+    struct esRcuReader * next;                                                  /**<@brief Next registered reader                           */
+};
+
+/**@brief       RCU reader type
+ * @api
+ */
+typedef struct esRcuReader esRcuReader;
+
+/**@brief       Deferred reclamation header
+ * @details     Embed it into the structure which is freed after a grace
+ *              period.
+ * @api
+ */
+struct esRcuHead {
+    struct esRcuHead *  next;                                                   /**<@brief Next deferred header                             */
+    void             (* reclaim)(struct esRcuHead * head);                      /**<@brief Function which frees the structure               */
+};
+
+/**@brief       Deferred reclamation header type
+ * @api
+ */
+typedef struct esRcuHead esRcuHead;
+
+/**@brief       RCU domain
+ * @details     Readers and writers of a list share one domain. One domain may
+ *              protect any number of lists.
+ * @api
+ */
+struct esRcu {
+    uint64_t            epoch PORT_C_ALIGN(ES_RCU_CACHE_LINE);                  /**<@brief Current epoch, changed by writers only           */
+    struct esRcuHead *  deferred;                                               /**<@brief Headers waiting for a grace period               */
+    struct esRcuReader * readers;                                               /**<@brief List of registered readers                       */
+    pthread_mutex_t     lock;                                                   /**<@brief Protects readers list and grace periods          */
+};
+
+/**@brief       RCU domain type
+ * @api
+ */
+typedef struct esRcu esRcu;
+
+/*======================================================  GLOBAL VARIABLES  ==*/
+/*===================================================  FUNCTION PROTOTYPES  ==*/
+
+/**@brief       Initialize RCU domain
+ * @api
+ */
+void esRcuInit(
+    struct esRcu *      rcu);
+
+/**@brief       Terminate RCU domain
+ * @details     All readers must be unregistered. Deferred headers are
+ *              reclaimed.
+ * @api
+ */
+void esRcuTerm(
+    struct esRcu *      rcu);
+
+/**@brief       Register calling thread as a reader
+ * @param       rcu
+ *              Pointer to RCU domain
+ * @param       reader
+ *              Reader state owned by calling thread
+ * @details     The reader is online after registration.
+ * @api
+ */
+void esRcuReaderRegister(
+    struct esRcu *      rcu,
+    struct esRcuReader * reader);
+
+/**@brief       Unregister a reader
+ * @api
+ */
+void esRcuReaderUnregister(
+    struct esRcu *      rcu,
+    struct esRcuReader * reader);
+
+/**@brief       Wait for a grace period and reclaim deferred headers
+ * @param       rcu
+ *              Pointer to RCU domain
+ * @details     Waits until each online reader has passed a quiescent state.
+ *              Calling thread must not be an online reader of this domain.
+ * @api
+ */
+void esRcuSynchronize(
+    struct esRcu *      rcu);
+
+/**@brief       Announce a quiescent state
+ * @param       rcu
+ *              Pointer to RCU domain
+ * @param       reader
+ *              Reader state of calling thread
+ * @details     Reader must not hold references to list nodes across this call.
+ *              Release store orders the preceding list reads before the
+ *              announcement.
+ * @api
+ */
+static PORT_C_INLINE void esRcuQuiescent(
+    struct esRcu *      rcu,
+    struct esRcuReader * reader) {
+
+    __atomic_store_n(&reader->epoch, __atomic_load_n(&rcu->epoch, __ATOMIC_ACQUIRE), __ATOMIC_RELEASE);
+}
+
+/**@brief       Put a reader offline
+ * @details     An offline reader is not waited for by writers, it must not
+ *              access list nodes until it goes online again.
+ * @api
+ */
+static PORT_C_INLINE void esRcuOffline(
+    struct esRcuReader * reader) {
+
+    __atomic_store_n(&reader->epoch, 0u, __ATOMIC_RELEASE);
+}
+
+/**@brief       Put a reader online
+ * @details     The full fence makes the reader visible to writers before it
+ *              reads any list node, otherwise a writer could miss the reader
+ *              and free a node which the reader is about to read.
+ * @api
+ */
+static PORT_C_INLINE void esRcuOnline(
+    struct esRcu *      rcu,
+    struct esRcuReader * reader) {
+
+    __atomic_store_n(&reader->epoch, __atomic_load_n(&rcu->epoch, __ATOMIC_ACQUIRE), __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+}
+
+/**@brief       Defer reclamation until the next grace period
+ * @param       rcu
+ *              Pointer to RCU domain
+ * @param       head
+ *              Reclamation header embedded into unlinked structure
+ * @param       reclaim
+ *              Function which frees the structure
+ * @details     The header is pushed lock-free, so writers never wait for a
+ *              grace period which is in progress.
+ * @api
+ */
+static PORT_C_INLINE void esRcuDefer(
+    struct esRcu *      rcu,
+    struct esRcuHead *  head,
+    void             (* reclaim)(struct esRcuHead *)) {
+
+    head->reclaim = reclaim;
+    head->next    = __atomic_load_n(&rcu->deferred, __ATOMIC_RELAXED);
+
+    while (__atomic_compare_exchange_n(&rcu->deferred, &head->next, head, true, __ATOMIC_RELEASE, __ATOMIC_RELAXED) == false) {
+        /* Retry with the current top */
+    }
+}
+
+/**@brief       Get next node in RCU list from a reader
+ * @details     On x86-64 an ordinary load is enough since loads are not
+ *              reordered with other loads. The atomic load only stops the
+ *              compiler from caching the pointer.
+ * @api
+ */
+static PORT_C_INLINE struct esDls * esRcuDlsNext(
+    const struct esDls * node) {
+
+    return (__atomic_load_n(&node->next, __ATOMIC_CONSUME));
+}
+
+/**@brief       Add a node after the given node
+ * @details     Node is initialized first and then published by a release
+ *              store, so readers never see it half linked.
+ * @api
+ */
+static PORT_C_INLINE void esRcuDlsNodeAddAfter(
+    struct esDls *      currNode,
+    struct esDls *      newNode) {
+
+    newNode->next = currNode->next;
+    newNode->prev = currNode;
+    currNode->next->prev = newNode;
+    __atomic_store_n(&currNode->next, newNode, __ATOMIC_RELEASE);
+}
+
+static PORT_C_INLINE void esRcuDlsNodeAddBefore(
+    struct esDls *      currNode,
+    struct esDls *      newNode) {
+
+    esRcuDlsNodeAddAfter(
+        currNode->prev,
+        newNode);
+}
+
+static PORT_C_INLINE void esRcuDlsNodeAddHead(
+    struct esDls *      sentinel,
+    struct esDls *      newNode) {
+
+    esRcuDlsNodeAddAfter(
+        sentinel,
+        newNode);
+}
+
+static PORT_C_INLINE void esRcuDlsNodeAddTail(
+    struct esDls *      sentinel,
+    struct esDls *      newNode) {
+
+    esRcuDlsNodeAddAfter(
+        sentinel->prev,
+        newNode);
+}
+
+/**@brief       Remove a node from RCU list
+ * @details     The @c next pointer of removed node is left intact for readers
+ *              which still stand on it. The node may be reused only after a
+ *              grace period.
+ * @api
+ */
+static PORT_C_INLINE void esRcuDlsNodeRm(
+    struct esDls *      oldNode) {
+
+    oldNode->next->prev = oldNode->prev;
+    __atomic_store_n(&oldNode->prev->next, oldNode->next, __ATOMIC_RELAXED);
+}
+
+/**@brief       Replace a node in RCU list
+ * @details     Readers see either the old or the new node, never both or
+ *              none. The old node may be reused only after a grace period.
+ * @api
+ */
+static PORT_C_INLINE void esRcuDlsNodeReplace(
+    struct esDls *      oldNode,
+    struct esDls *      newNode) {
+
+    newNode->next = oldNode->next;
+    newNode->prev = oldNode->prev;
+    oldNode->next->prev = newNode;
+    __atomic_store_n(&oldNode->prev->next, newNode, __ATOMIC_RELEASE);
+}
+
+/*--------------------------------------------------------  C++ extern end  --*/
+#ifdef __cplusplus
+}
+#endif
+
+/*================================*//** @cond *//*==  CONFIGURATION ERRORS  ==*/
+/** @endcond *//** @} *//** @} *//*********************************************
+ * END of rcu_list.h
+ ******************************************************************************/
+#endif /* ES_ARCH_RCU_LIST_H_ */
@@ -0,0 +1,284 @@
+/*
+ * This file is part of eSolid.
+ *
+ * Copyright (C) 2010 - 2013 Nenad Radulovic
+ *
+ * eSolid is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * eSolid is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with eSolid.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * web site:    http://github.com/nradulovic
+ * e-mail  :    nenad.b.radulovic@gmail.com
+ *//***********************************************************************//**
+ * @file
+ * @author      Nenad Radulovic
+ * @brief       Interface of shared memory queue port.
+ * @addtogroup  x86-64-linux-gcc
+ *********************************************************************//** @{ */
+/**@defgroup    x86-64-linux-gcc-shm_queue Shared memory queue
+ * @brief       Shared memory queue
+ * @details     Single producer, single consumer queue which can be shared
+ *              between two processes. Queue header and fixed size slots are
+ *              placed in a shared memory object and slots are addressed by
+ *              their offset from the header, so the object may be mapped at a
+ *              different address in each process. Producer writes a message
+ *              directly into a reserved slot and consumer reads it in place,
+ *              so messages are not copied and no system calls are made when
+ *              putting or getting a message.
+ *
+ *              The shared memory object is either a named POSIX shared memory
+ *              object or an anonymous memory file whose descriptor is passed to
+ *              the other process by fork() or over a UNIX domain socket.
+ * @{ *//*--------------------------------------------------------------------*/
+
+#ifndef ES_ARCH_SHM_QUEUE_H_
+#define ES_ARCH_SHM_QUEUE_H_
+
+/*=========================================================  INCLUDE FILES  ==*/
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stddef.h>
+
+#include "plat/compiler.h"
+#include "base/error.h"
+
+/*===============================================================  MACRO's  ==*/
+
+/**@brief       Size of CPU cache line used to separate producer and consumer
+ *              data
+ */
+#define ES_SHM_QP_CACHE_LINE            64u
+
+/*------------------------------------------------------  C++ extern begin  --*/
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*============================================================  DATA TYPES  ==*/
+
+/**@brief       Shared memory queue header
+ * @details     This structure is placed at the beginning of shared memory
+ *              object and it is followed by the slots. Indexes are free
+ *              running, the slot position is obtained by masking the index with
+ *              <code>size - 1</code>.
+ * @notapi
+ */
+struct esShmQpHdr {
+    uint32_t            magic;                                                  /**<@brief Set when the header is initialized               */
+    uint32_t            mask;                                                   /**<@brief Number of slots minus one                        */
+    uint32_t            slotSize;                                               /**<@brief Size of one slot in bytes                        */
+    uint32_t            head PORT_C_ALIGN(ES_SHM_QP_CACHE_LINE);                /**<@brief Producer index                                   */
+    uint32_t            tail PORT_C_ALIGN(ES_SHM_QP_CACHE_LINE);                /**<@brief Consumer index                                   */
+};
+
+/**@brief       Shared memory queue
+ * @details     This structure is local to a process and it describes how the
+ *              shared memory object is mapped in the process.
+ * @api
+ */
+struct esShmQp {
+    struct esShmQpHdr * hdr;                                                    /**<@brief Mapped queue header                              */
+    uint8_t *           slot;                                                   /**<@brief Mapped slots                                     */
+    uint32_t            mask;                                                   /**<@brief Number of slots minus one                        */
+    uint32_t            slotSize;                                               /**<@brief Size of one slot in bytes                        */
+    uint32_t            head;                                                   /**<@brief Last producer index seen by consumer             */
+    uint32_t            tail;                                                   /**<@brief Last consumer index seen by producer             */
+    size_t              mapSize;                                                /**<@brief Size of mapping in bytes                         */
+    int                 fd;                                                     /**<@brief Shared memory object descriptor                  */
+};
+
+/**@brief       Shared memory queue type
+ * @api
+ */
+typedef struct esShmQp esShmQp;
+
+/*======================================================  GLOBAL VARIABLES  ==*/
+/*===================================================  FUNCTION PROTOTYPES  ==*/
+
+/**@brief       Create a shared memory queue
+ * @param       qp
+ *              Pointer to shared memory queue
+ * @param       name
+ *              Name of POSIX shared memory object, starting with a slash. When
+ *              it is NULL an anonymous memory file is created, see
+ *              @ref esShmQpFd.
+ * @param       size
+ *              Number of slots, must be a power of two
+ * @param       slotSize
+ *              Size of one slot in bytes
+ * @return      Operation status
+ *  @retval     ES_ERROR_NONE - the queue is created
+ *  @retval     ES_ERROR_NO_RESOURCE - the object can not be created, or an
+ *              object with the same name already exists
+ *  @retval     ES_ERROR_NO_MEMORY - the object can not be sized or mapped
+ * @api
+ */
+esError esShmQpCreate(
+    struct esShmQp *    qp,
+    const char *        name,
+    size_t              size,
+    size_t              slotSize);
+
+/**@brief       Open a named shared memory queue
+ * @param       qp
+ *              Pointer to shared memory queue
+ * @param       name
+ *              Name which was given to @ref esShmQpCreate
+ * @return      Operation status
+ *  @retval     ES_ERROR_NONE - the queue is opened
+ *  @retval     ES_ERROR_OBJECT_NFOUND - there is no object with this name
+ *  @retval     ES_ERROR_OBJECT_INVALID - the object is not a queue
+ *  @retval     ES_ERROR_NO_MEMORY - the object can not be mapped
+ * @api
+ */
+esError esShmQpOpen(
+    struct esShmQp *    qp,
+    const char *        name);
+
+/**@brief       Open a shared memory queue by descriptor
+ * @param       qp
+ *              Pointer to shared memory queue
+ * @param       fd
+ *              Descriptor of shared memory object. The descriptor is
+ *              duplicated and the caller may close it after this call.
+ * @return      Operation status, see @ref esShmQpOpen
+ * @api
+ */
+esError esShmQpOpenFd(
+    struct esShmQp *    qp,
+    int                 fd);
+
+/**@brief       Close a shared memory queue
+ * @param       qp
+ *              Pointer to shared memory queue
+ * @details     The shared memory object is destroyed when all processes have
+ *              closed it and, for named objects, after @ref esShmQpUnlink.
+ * @api
+ */
+void esShmQpClose(
+    struct esShmQp *    qp);
+
+/**@brief       Remove the name of a shared memory queue
+ * @param       name
+ *              Name which was given to @ref esShmQpCreate
+ * @api
+ */
+void esShmQpUnlink(
+    const char *        name);
+
+/**@brief       Get descriptor of shared memory object
+ * @param       qp
+ *              Pointer to shared memory queue
+ * @return      Descriptor which can be passed to @ref esShmQpOpenFd in other
+ *              process
+ * @api
+ */
+static PORT_C_INLINE int esShmQpFd(
+    const struct esShmQp * qp) {
+
+    return (qp->fd);
+}
+
+static PORT_C_INLINE size_t esShmQpSlotSize(
+    const struct esShmQp * qp) {
+
+    return ((size_t)qp->slotSize);
+}
+
+/**@brief       Reserve a slot for a new message
+ * @param       qp
+ *              Pointer to shared memory queue
+ * @return      Pointer to slot where producer should write the message
+ *  @retval     NULL - the queue is full
+ * @details     The message is not visible to consumer until it is published
+ *              by @ref esShmQpPublish.
+ * @api
+ */
+static PORT_C_INLINE void * esShmQpReserve(
+    struct esShmQp *    qp) {
+
+    uint32_t            head;
+
+    head = qp->hdr->head;
+
+    if ((head - qp->tail) > qp->mask) {                                         /* Is the queue full for the last seen consumer index?      */
+        qp->tail = __atomic_load_n(&qp->hdr->tail, __ATOMIC_ACQUIRE);
+
+        if ((head - qp->tail) > qp->mask) {
+
+            return (NULL);
+        }
+    }
+
+    return (&qp->slot[(size_t)(head & qp->mask) * qp->slotSize]);
+}
+
+/**@brief       Publish the reserved message
+ * @param       qp
+ *              Pointer to shared memory queue
+ * @api
+ */
+static PORT_C_INLINE void esShmQpPublish(
+    struct esShmQp *    qp) {
+
+    __atomic_store_n(&qp->hdr->head, qp->hdr->head + 1u, __ATOMIC_RELEASE);
+}
+
+/**@brief       Peek at the oldest message
+ * @param       qp
+ *              Pointer to shared memory queue
+ * @return      Pointer to slot which holds the message
+ *  @retval     NULL - the queue is empty
+ * @api
+ */
+static PORT_C_INLINE void * esShmQpPeek(
+    struct esShmQp *    qp) {
+
+    uint32_t            tail;
+
+    tail = qp->hdr->tail;
+
+    if (tail == qp->head) {                                                     /* Is the queue empty for the last seen producer index?     */
+        qp->head = __atomic_load_n(&qp->hdr->head, __ATOMIC_ACQUIRE);
+
+        if (tail == qp->head) {
+
+            return (NULL);
+        }
+    }
+
+    return (&qp->slot[(size_t)(tail & qp->mask) * qp->slotSize]);
+}
+
+/**@brief       Release the oldest message
+ * @param       qp
+ *              Pointer to shared memory queue
+ * @details     After this call the slot may be reused by producer.
+ * @api
+ */
+static PORT_C_INLINE void esShmQpRelease(
+    struct esShmQp *    qp) {
+
+    __atomic_store_n(&qp->hdr->tail, qp->hdr->tail + 1u, __ATOMIC_RELEASE);
+}
+
+/*--------------------------------------------------------  C++ extern end  --*/
+#ifdef __cplusplus
+}
+#endif
+
+/*================================*//** @cond *//*==  CONFIGURATION ERRORS  ==*/
+/** @endcond *//** @} *//******************************************************
+ * END of shm_queue.h
+ ******************************************************************************/
+#endif /* ES_ARCH_SHM_QUEUE_H_ */
@@ -0,0 +1,253 @@
+/*
+ * This file is part of eSolid.
+ *
+ * Copyright (C) 2010 - 2013 Nenad Radulovic
+ *
+ * eSolid is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * eSolid is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with eSolid.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * web site:    http://github.com/nradulovic
+ * e-mail  :    nenad.b.radulovic@gmail.com
+ *//***********************************************************************//**
+ * @file
+ * @author      Nenad Radulovic
+ * @brief       Interface of work stealing queue port.
+ * @addtogroup  x86-64-linux-gcc
+ *********************************************************************//** @{ */
+/**@defgroup    x86-64-linux-gcc-ws_queue Work stealing queue
+ * @brief       Work stealing queue
+ * @details     Chase-Lev work stealing deque. The owner thread pushes and pops
+ *              items at the bottom end, like a stack, and other threads steal
+ *              items from the top end. The owner uses plain loads and stores,
+ *              except when it pops the last item, where it races with thieves.
+ *              Thieves compete for the top item with compare and swap.
+ *
+ *              The queue buffer is a circular array which doubles when the
+ *              owner pushes into a full queue. Thieves may still read from an
+ *              old array, so old arrays are freed only when the queue is
+ *              terminated.
+ * @{ *//*--------------------------------------------------------------------*/
+
+#ifndef ES_ARCH_WS_QUEUE_H_
+#define ES_ARCH_WS_QUEUE_H_
+
+/*=========================================================  INCLUDE FILES  ==*/
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stddef.h>
+
+#include "plat/compiler.h"
+#include "base/error.h"
+
+/*===============================================================  MACRO's  ==*/
+
+/**@brief       Size of CPU cache line used to separate owner and thief data
+ */
+#define ES_WSQ_CACHE_LINE               64u
+
+/*------------------------------------------------------  C++ extern begin  --*/
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*============================================================  DATA TYPES  ==*/
+
+/**@brief       Circular array of work stealing queue
+ * @notapi
+ */
+struct esWsqArray {
+    struct esWsqArray * next;                                                   /**<@brief Next retired array                               */
+    int64_t             mask;                                                   /**<@brief Size of array minus one                          */
+    void *              buff[];                                                 /**<@brief Array elements                                   */
+};
+
+/**@brief       Work stealing queue
+ * @details     Indexes are free running, the position in array is obtained by
+ *              masking the index with array mask.
+ * @api
+ */
+struct esWsq {
+    int64_t             top PORT_C_ALIGN(ES_WSQ_CACHE_LINE);                    /**<@brief Index of the oldest item, thieves take from here */
+    int64_t             bottom PORT_C_ALIGN(ES_WSQ_CACHE_LINE);                 /**<@brief Index of the next push, owned by owner           */
+    struct esWsqArray * array;                                                  /**<@brief Current array                                    */
+    struct esWsqArray * retired;                                                /**<@brief List of arrays replaced by grow                  */
+};
+
+/**@brief       Work stealing queue type
+ * @api
+ */
+typedef struct esWsq esWsq;
+
+/*======================================================  GLOBAL VARIABLES  ==*/
+/*===================================================  FUNCTION PROTOTYPES  ==*/
+
+/**@brief       Initialize work stealing queue
+ * @param       wsq
+ *              Pointer to work stealing queue
+ * @param       size
+ *              Initial number of elements, must be a power of two
+ * @return      Operation status
+ *  @retval     ES_ERROR_NONE - the queue is initialized
+ *  @retval     ES_ERROR_NO_MEMORY - the array can not be allocated
+ * @api
+ */
+esError esWsqInit(
+    struct esWsq *      wsq,
+    size_t              size);
+
+/**@brief       Terminate work stealing queue
+ * @param       wsq
+ *              Pointer to work stealing queue
+ * @details     All thieves must have stopped using the queue.
+ * @api
+ */
+void esWsqTerm(
+    struct esWsq *      wsq);
+
+/**@brief       Double the size of array
+ * @notapi
+ */
+esError esWsqGrow_(
+    struct esWsq *      wsq,
+    int64_t             top,
+    int64_t             bottom);
+
+/**@brief       Push an item at the bottom of queue
+ * @param       wsq
+ *              Pointer to work stealing queue
+ * @param       item
+ *              Item to push
+ * @return      Operation status
+ *  @retval     ES_ERROR_NONE - the item was pushed
+ *  @retval     ES_ERROR_NO_MEMORY - the queue is full and it can not grow
+ * @details     May be called only by the owner thread.
+ * @api
+ */
+static PORT_C_INLINE esError esWsqPush(
+    struct esWsq *      wsq,
+    void *              item) {
+
+    int64_t             bottom;
+    int64_t             top;
+    struct esWsqArray * array;
+
+    bottom = __atomic_load_n(&wsq->bottom, __ATOMIC_RELAXED);
+    top    = __atomic_load_n(&wsq->top,    __ATOMIC_ACQUIRE);
+    array  = wsq->array;
+
+    if ((bottom - top) > array->mask) {
+        esError         error;
+
+        error = esWsqGrow_(wsq, top, bottom);
+
+        if (error != ES_ERROR_NONE) {
+
+            return (error);
+        }
+        array = wsq->array;
+    }
+    __atomic_store_n(&array->buff[bottom & array->mask], item, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+    __atomic_store_n(&wsq->bottom, bottom + 1, __ATOMIC_RELAXED);
+
+    return (ES_ERROR_NONE);
+}
+
+/**@brief       Pop the newest item from the bottom of queue
+ * @param       wsq
+ *              Pointer to work stealing queue
+ * @param       item
+ *              Pointer to variable which will receive the item
+ * @return      Was an item popped?
+ * @details     May be called only by the owner thread.
+ * @api
+ */
+static PORT_C_INLINE bool esWsqPop(
+    struct esWsq *      wsq,
+    void **             item) {
+
+    int64_t             bottom;
+    int64_t             top;
+    struct esWsqArray * array;
+    bool                isPopped;
+
+    bottom = __atomic_load_n(&wsq->bottom, __ATOMIC_RELAXED) - 1;
+    array  = wsq->array;
+    __atomic_store_n(&wsq->bottom, bottom, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);                                    /* Thieves must see the new bottom before top is read       */
+    top    = __atomic_load_n(&wsq->top, __ATOMIC_RELAXED);
+
+    if (top > bottom) {                                                         /* Queue was empty                                          */
+        __atomic_store_n(&wsq->bottom, bottom + 1, __ATOMIC_RELAXED);
+
+        return (false);
+    }
+    *item    = __atomic_load_n(&array->buff[bottom & array->mask], __ATOMIC_RELAXED);
+    isPopped = true;
+
+    if (top == bottom) {                                                        /* The last item: race with thieves for it                  */
+
+        if (__atomic_compare_exchange_n(&wsq->top, &top, top + 1, false, __ATOMIC_SEQ_CST, __ATOMIC_RELAXED) == false) {
+            isPopped = false;
+        }
+        __atomic_store_n(&wsq->bottom, bottom + 1, __ATOMIC_RELAXED);
+    }
+
+    return (isPopped);
+}
+
+/**@brief       Steal the oldest item from the top of queue
+ * @param       wsq
+ *              Pointer to work stealing queue
+ * @param       item
+ *              Pointer to variable which will receive the item
+ * @return      Was an item stolen?
+ *  @retval     true - the item was stolen
+ *  @retval     false - the queue is empty or another thread took the item
+ *              first, the caller may retry or try another queue
+ * @details     May be called by any thread.
+ * @api
+ */
+static PORT_C_INLINE bool esWsqSteal(
+    struct esWsq *      wsq,
+    void **             item) {
+
+    int64_t             top;
+    int64_t             bottom;
+    struct esWsqArray * array;
+
+    top    = __atomic_load_n(&wsq->top, __ATOMIC_ACQUIRE);
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+    bottom = __atomic_load_n(&wsq->bottom, __ATOMIC_ACQUIRE);
+
+    if (top >= bottom) {
+
+        return (false);
+    }
+    array = __atomic_load_n(&wsq->array, __ATOMIC_ACQUIRE);
+    *item = __atomic_load_n(&array->buff[top & array->mask], __ATOMIC_RELAXED);
+
+    return (__atomic_compare_exchange_n(&wsq->top, &top, top + 1, false, __ATOMIC_SEQ_CST, __ATOMIC_RELAXED));
+}
+
+/*--------------------------------------------------------  C++ extern end  --*/
+#ifdef __cplusplus
+}
+#endif
+
+/*================================*//** @cond *//*==  CONFIGURATION ERRORS  ==*/
+/** @endcond *//** @} *//******************************************************
+ * END of ws_queue.h
+ ******************************************************************************/
+#endif /* ES_ARCH_WS_QUEUE_H_ */
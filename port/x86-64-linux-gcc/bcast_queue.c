@@ -0,0 +1,139 @@
+/*
+ * This file is part of eSolid.
+ *
+ * Copyright (C) 2010 - 2013 Nenad Radulovic
+ *
+ * eSolid is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * eSolid is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with eSolid.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * web site:    http://github.com/nradulovic
+ * e-mail  :    nenad.b.radulovic@gmail.com
+ *//***********************************************************************//**
+ * @file
+ * @author      Nenad Radulovic
+ * @brief       Implementation of broadcast pointer queue port.
+ * @addtogroup  x86-64-linux-gcc-bcast_queue
+ *********************************************************************//** @{ */
+
+/*=========================================================  INCLUDE FILES  ==*/
+
+#include "plat/compiler.h"
+#include "base/base.h"
+#include "base/debug.h"
+#include "base/bitop.h"
+#include "arch/bcast_queue.h"
+
+/*=========================================================  LOCAL MACRO's  ==*/
+/*======================================================  LOCAL DATA TYPES  ==*/
+/*=============================================  LOCAL FUNCTION PROTOTYPES  ==*/
+/*=======================================================  LOCAL VARIABLES  ==*/
+
+static const ES_MODULE_INFO_CREATE("Bcast queue", "Broadcast pointer queue", "Nenad Radulovic");
+
+/*======================================================  GLOBAL VARIABLES  ==*/
+/*============================================  LOCAL FUNCTION DEFINITIONS  ==*/
+/*===================================  GLOBAL PRIVATE FUNCTION DEFINITIONS  ==*/
+
+/* 1)       Without readers nobody gates the producer and items are overwritten.
+ */
+uint64_t esQpBcastGating_(
+    struct esQpBcast *  bq) {
+
+    uint64_t            gating;
+    uint64_t            cursor;
+    uint_fast8_t        cnt;
+
+    gating = bq->published;                                                     /* See note 1.                                              */
+
+    for (cnt = 0u; cnt < bq->readers; cnt++) {
+        cursor = __atomic_load_n(&bq->reader[cnt]->cursor, __ATOMIC_ACQUIRE);
+
+        if (cursor < gating) {
+            gating = cursor;
+        }
+    }
+    bq->gating = gating;
+
+    return (gating);
+}
+
+/*====================================  GLOBAL PUBLIC FUNCTION DEFINITIONS  ==*/
+
+void esQpBcastInit(
+    struct esQpBcast *  bq,
+    void **             buff,
+    size_t              size) {
+
+    ES_REQUIRE(ES_API_POINTER, bq != NULL);
+    ES_REQUIRE(ES_API_POINTER, buff != NULL);
+    ES_REQUIRE(ES_API_RANGE,   size != 0u);
+    ES_REQUIRE(ES_API_RANGE,   ES_IS_PWR2(size));
+
+    bq->buff      = buff;
+    bq->mask      = (uint64_t)size - 1u;
+    bq->readers   = 0u;
+    bq->gating    = 0u;
+    bq->published = 0u;
+}
+
+void esQpBcastTerm(
+    struct esQpBcast *  bq) {
+
+    ES_REQUIRE(ES_API_POINTER, bq != NULL);
+    ES_REQUIRE(ES_API_USAGE,   bq->readers == 0u);
+
+    bq->buff = NULL;
+    bq->mask = 0u;
+}
+
+void esQpBcastAttach(
+    struct esQpBcast *  bq,
+    struct esQpBcastReader * reader) {
+
+    ES_REQUIRE(ES_API_POINTER, bq != NULL);
+    ES_REQUIRE(ES_API_POINTER, reader != NULL);
+    ES_REQUIRE(ES_API_USAGE,   bq->readers < CONFIG_QP_BCAST_READERS);
+
+    reader->cursor = bq->published;
+    reader->queue  = bq;
+    bq->reader[bq->readers++] = reader;
+    (void)esQpBcastGating_(bq);
+}
+
+void esQpBcastDetach(
+    struct esQpBcastReader * reader) {
+
+    struct esQpBcast *  bq;
+    uint_fast8_t        cnt;
+
+    ES_REQUIRE(ES_API_POINTER, reader != NULL);
+    ES_REQUIRE(ES_API_OBJECT,  reader->queue != NULL);
+
+    bq = reader->queue;
+
+    for (cnt = 0u; cnt < bq->readers; cnt++) {
+
+        if (bq->reader[cnt] == reader) {
+            bq->reader[cnt] = bq->reader[--bq->readers];
+
+            break;
+        }
+    }
+    reader->queue = NULL;
+    (void)esQpBcastGating_(bq);
+}
+
+/*================================*//** @cond *//*==  CONFIGURATION ERRORS  ==*/
+/** @endcond *//** @} *//******************************************************
+ * END of bcast_queue.c
+ ******************************************************************************/
@@ -87,6 +87,15 @@
  */
 #define PORT_C_ALIGN(align)             __attribute__((aligned (align)))
 
+/**@brief       Prefetch the memory at given address into data cache
+ */
+#define PORT_C_PREFETCH(addr)           __builtin_prefetch((addr))
+
+/**@brief       Number of nodes ahead of the current node which are prefetched
+ *              by list iteration macros, 1 or 2
+ */
+#define PORT_C_PREFETCH_DISTANCE        2u
+
 /**@brief       A standardized way of properly setting the value of HW register
  * @param       reg
  *              Register which will be written to
@@ -114,7 +123,7 @@ extern "C" {
 
 /**@brief General purpose registers are 64bit wide.
  */
-typedef unsigned int esAtomic;
+typedef unsigned long esAtomic;
 
 /*======================================================  GLOBAL VARIABLES  ==*/
 /*===================================================  FUNCTION PROTOTYPES  ==*/
@@ -0,0 +1,122 @@
+/*
+ * This file is part of eSolid.
+ *
+ * Copyright (C) 2010 - 2013 Nenad Radulovic
+ *
+ * eSolid is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * eSolid is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with eSolid.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * web site:    http://github.com/nradulovic
+ * e-mail  :    nenad.b.radulovic@gmail.com
+ *//***********************************************************************//**
+ * @file
+ * @author      Nenad Radulovic
+ * @brief       Implementation of mirrored memory buffer port.
+ * @addtogroup  x86-64-linux-gcc-mirror
+ *********************************************************************//** @{ */
+
+/*=========================================================  INCLUDE FILES  ==*/
+
+#if !defined(_GNU_SOURCE)
+# define _GNU_SOURCE                                                            /* Needed for memfd_create()                                */
+#endif
+
+#include <stdint.h>
+#include <unistd.h>
+#include <sys/mman.h>
+
+#include "plat/compiler.h"
+#include "base/base.h"
+#include "base/debug.h"
+#include "arch/mirror.h"
+
+/*=========================================================  LOCAL MACRO's  ==*/
+/*======================================================  LOCAL DATA TYPES  ==*/
+/*=============================================  LOCAL FUNCTION PROTOTYPES  ==*/
+/*=======================================================  LOCAL VARIABLES  ==*/
+
+static const ES_MODULE_INFO_CREATE("Mirror", "Mirrored memory buffer", "Nenad Radulovic");
+
+/*======================================================  GLOBAL VARIABLES  ==*/
+/*============================================  LOCAL FUNCTION DEFINITIONS  ==*/
+/*===================================  GLOBAL PRIVATE FUNCTION DEFINITIONS  ==*/
+/*====================================  GLOBAL PUBLIC FUNCTION DEFINITIONS  ==*/
+
+/* 1)       The whole address range is reserved first so the two mappings of
+ *          the memory file can be placed back to back with MAP_FIXED without
+ *          overwriting somebody else's mapping.
+ * 2)       Mappings keep a reference to the memory file, so the descriptor is
+ *          not needed after the mappings are made.
+ */
+esError esMirrorInit(
+    struct esMirror *   mirror,
+    size_t              size) {
+
+    int                 fd;
+    uint8_t *           base;
+
+    ES_REQUIRE(ES_API_POINTER, mirror != NULL);
+    ES_REQUIRE(ES_API_RANGE,   size != 0u);
+    ES_REQUIRE(ES_API_RANGE,   (size % (size_t)sysconf(_SC_PAGESIZE)) == 0u);
+
+    mirror->base = NULL;
+    mirror->size = 0u;
+    fd = memfd_create("esMirror", MFD_CLOEXEC);
+
+    if (fd == -1) {
+
+        return (ES_ERROR_NO_MEMORY);
+    }
+
+    if (ftruncate(fd, (off_t)size) != 0) {
+        (void)close(fd);
+
+        return (ES_ERROR_NO_MEMORY);
+    }
+    base = mmap(NULL, size * 2u, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);/* See note 1.                                              */
+
+    if (base == MAP_FAILED) {
+        (void)close(fd);
+
+        return (ES_ERROR_NO_MEMORY);
+    }
+
+    if ((mmap(base,        size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, fd, 0) == MAP_FAILED) ||
+        (mmap(base + size, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, fd, 0) == MAP_FAILED)) {
+        (void)munmap(base, size * 2u);
+        (void)close(fd);
+
+        return (ES_ERROR_NO_MEMORY);
+    }
+    (void)close(fd);                                                            /* See note 2.                                              */
+    mirror->base = base;
+    mirror->size = size;
+
+    return (ES_ERROR_NONE);
+}
+
+void esMirrorTerm(
+    struct esMirror *   mirror) {
+
+    ES_REQUIRE(ES_API_POINTER, mirror != NULL);
+    ES_REQUIRE(ES_API_OBJECT,  mirror->base != NULL);
+
+    (void)munmap(mirror->base, mirror->size * 2u);
+    mirror->base = NULL;
+    mirror->size = 0u;
+}
+
+/*================================*//** @cond *//*==  CONFIGURATION ERRORS  ==*/
+/** @endcond *//** @} *//******************************************************
+ * END of mirror.c
+ ******************************************************************************/
@@ -0,0 +1,116 @@
+/*
+ * This file is part of eSolid.
+ *
+ * Copyright (C) 2010 - 2013 Nenad Radulovic
+ *
+ * eSolid is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * eSolid is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with eSolid.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * web site:    http://github.com/nradulovic
+ * e-mail  :    nenad.b.radulovic@gmail.com
+ *//***********************************************************************//**
+ * @file
+ * @author      Nenad Radulovic
+ * @brief       Implementation of queue readiness notifier port.
+ * @addtogroup  x86-64-linux-gcc-queue_notify
+ *********************************************************************//** @{ */
+
+/*=========================================================  INCLUDE FILES  ==*/
+
+#include <stdint.h>
+#include <unistd.h>
+#include <sys/eventfd.h>
+
+#include "plat/compiler.h"
+#include "base/base.h"
+#include "base/debug.h"
+#include "arch/queue_notify.h"
+
+/*=========================================================  LOCAL MACRO's  ==*/
+/*======================================================  LOCAL DATA TYPES  ==*/
+/*=============================================  LOCAL FUNCTION PROTOTYPES  ==*/
+/*=======================================================  LOCAL VARIABLES  ==*/
+
+static const ES_MODULE_INFO_CREATE("Queue notify", "Queue readiness notifier", "Nenad Radulovic");
+
+/*======================================================  GLOBAL VARIABLES  ==*/
+/*============================================  LOCAL FUNCTION DEFINITIONS  ==*/
+/*===================================  GLOBAL PRIVATE FUNCTION DEFINITIONS  ==*/
+/*====================================  GLOBAL PUBLIC FUNCTION DEFINITIONS  ==*/
+
+esError esQNotifyInit(
+    struct esQNotify *  notify) {
+
+    ES_REQUIRE(ES_API_POINTER, notify != NULL);
+
+    notify->fd = eventfd(0u, EFD_NONBLOCK | EFD_CLOEXEC);
+
+    if (notify->fd == -1) {
+
+        return (ES_ERROR_NO_RESOURCE);
+    }
+    notify->isSignalled = 0u;
+
+    return (ES_ERROR_NONE);
+}
+
+void esQNotifyTerm(
+    struct esQNotify *  notify) {
+
+    ES_REQUIRE(ES_API_POINTER, notify != NULL);
+    ES_REQUIRE(ES_API_OBJECT,  notify->fd != -1);
+
+    (void)close(notify->fd);
+    notify->fd = -1;
+}
+
+/* 1)       Only the first signal after an acknowledge writes the descriptor,
+ *          all other signals are coalesced into it.
+ */
+void esQNotifySignal(
+    struct esQNotify *  notify) {
+
+    uint64_t            value;
+
+    ES_REQUIRE(ES_API_POINTER, notify != NULL);
+    ES_REQUIRE(ES_API_OBJECT,  notify->fd != -1);
+
+    if (__atomic_exchange_n(&notify->isSignalled, 1u, __ATOMIC_ACQ_REL) == 0u) {/* See note 1.                                              */
+        value = 1u;
+        (void)write(notify->fd, &value, sizeof(value));
+    }
+}
+
+/* 1)       The descriptor is read before the flag is cleared. A signal which
+ *          comes before the flag is cleared is coalesced, but its item is seen
+ *          by the consumer which drains the queue after this call. A signal
+ *          which comes after the flag is cleared writes the descriptor again.
+ */
+void esQNotifyAck(
+    struct esQNotify *  notify) {
+
+    uint64_t            value;
+
+    ES_REQUIRE(ES_API_POINTER, notify != NULL);
+    ES_REQUIRE(ES_API_OBJECT,  notify->fd != -1);
+
+    if (__atomic_load_n(&notify->isSignalled, __ATOMIC_ACQUIRE) != 0u) {
+        (void)read(notify->fd, &value, sizeof(value));
+        __atomic_store_n(&notify->isSignalled, 0u, __ATOMIC_SEQ_CST);           /* See note 1.                                              */
+    }
+}
+
+/*================================*//** @cond *//*==  CONFIGURATION ERRORS  ==*/
+/** @endcond *//** @} *//******************************************************
+ * END of queue_notify.c
+ ******************************************************************************/
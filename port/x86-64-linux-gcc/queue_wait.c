@@ -0,0 +1,305 @@
+/*
+ * This file is part of eSolid.
+ *
+ * Copyright (C) 2010 - 2013 Nenad Radulovic
+ *
+ * eSolid is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * eSolid is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with eSolid.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * web site:    http://github.com/nradulovic
+ * e-mail  :    nenad.b.radulovic@gmail.com
+ *//***********************************************************************//**
+ * @file
+ * @author      Nenad Radulovic
+ * @brief       Implementation of blocking pointer queue port.
+ * @addtogroup  x86-64-linux-gcc-queue_wait
+ *********************************************************************//** @{ */
+
+/*=========================================================  INCLUDE FILES  ==*/
+
+#if !defined(_GNU_SOURCE)
+# define _GNU_SOURCE                                                            /* Needed for syscall() and clock_gettime()                 */
+#endif
+
+#include <errno.h>
+#include <limits.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/syscall.h>
+#include <linux/futex.h>
+
+#include "plat/compiler.h"
+#include "base/base.h"
+#include "base/debug.h"
+#include "base/bitop.h"
+#include "arch/queue_wait.h"
+
+/*=========================================================  LOCAL MACRO's  ==*/
+
+#define NSEC_PER_SEC                    1000000000l
+
+#define NSEC_PER_MSEC                   1000000l
+
+/*======================================================  LOCAL DATA TYPES  ==*/
+/*=============================================  LOCAL FUNCTION PROTOTYPES  ==*/
+
+/**@brief       Calculate absolute deadline on monotonic clock
+ * @param       deadline
+ *              Pointer to time structure which will receive the deadline
+ * @param       timeout
+ *              Timeout in milliseconds
+ * @return      Pointer to deadline or NULL when timeout is infinite
+ */
+static const struct timespec * deadlineInit(
+    struct timespec *   deadline,
+    uint32_t            timeout);
+
+/**@brief       Wait until the index changes from the value @c seen
+ * @param       index
+ *              Pointer to index which is watched
+ * @param       waiters
+ *              Pointer to waiters counter of the index
+ * @param       seen
+ *              The last seen value of the index
+ * @param       deadline
+ *              Absolute deadline or NULL
+ * @return      Operation status
+ *  @retval     ES_ERROR_NONE - the index has changed
+ *  @retval     ES_ERROR_TIMEOUT - the deadline has passed
+ */
+static esError indexWait(
+    uint32_t *          index,
+    uint32_t *          waiters,
+    uint32_t            seen,
+    const struct timespec * deadline);
+
+/**@brief       Wake threads parked on the index
+ * @param       index
+ *              Pointer to index which has changed
+ */
+static void indexWake(
+    uint32_t *          index);
+
+/*=======================================================  LOCAL VARIABLES  ==*/
+
+static const ES_MODULE_INFO_CREATE("Queue wait", "Blocking pointer queue", "Nenad Radulovic");
+
+/*======================================================  GLOBAL VARIABLES  ==*/
+/*============================================  LOCAL FUNCTION DEFINITIONS  ==*/
+
+static const struct timespec * deadlineInit(
+    struct timespec *   deadline,
+    uint32_t            timeout) {
+
+    if (timeout == ES_QP_WAIT_FOREVER) {
+
+        return (NULL);
+    }
+    (void)clock_gettime(CLOCK_MONOTONIC, deadline);
+    deadline->tv_sec  += (time_t)(timeout / 1000u);
+    deadline->tv_nsec += (long)(timeout % 1000u) * NSEC_PER_MSEC;
+
+    if (deadline->tv_nsec >= NSEC_PER_SEC) {
+        deadline->tv_nsec -= NSEC_PER_SEC;
+        deadline->tv_sec++;
+    }
+
+    return (deadline);
+}
+
+/* 1)       The waiter is registered before the index is checked for the last
+ *          time. Together with sequentially consistent index update on the
+ *          other side this guarantees that either the other side sees the
+ *          waiter and wakes it up, or this side sees the new index value.
+ * 2)       FUTEX_WAIT_BITSET takes absolute timeout on the monotonic clock.
+ *          The kernel returns immediately when the index no longer holds the
+ *          seen value.
+ */
+static esError indexWait(
+    uint32_t *          index,
+    uint32_t *          waiters,
+    uint32_t            seen,
+    const struct timespec * deadline) {
+
+    uint32_t            spin;
+    esError             error;
+
+    for (spin = 0u; spin < CONFIG_QP_WAIT_SPIN; spin++) {
+
+        if (__atomic_load_n(index, __ATOMIC_ACQUIRE) != seen) {
+
+            return (ES_ERROR_NONE);
+        }
+        __builtin_ia32_pause();
+    }
+    error = ES_ERROR_NONE;
+    (void)__atomic_fetch_add(waiters, 1u, __ATOMIC_SEQ_CST);                    /* See note 1.                                              */
+
+    while (__atomic_load_n(index, __ATOMIC_SEQ_CST) == seen) {
+
+        if ((syscall(SYS_futex, index, FUTEX_WAIT_BITSET | FUTEX_PRIVATE_FLAG,
+                seen, deadline, NULL, FUTEX_BITSET_MATCH_ANY) == -1) &&
+            (errno == ETIMEDOUT)) {                                             /* See note 2.                                              */
+            error = ES_ERROR_TIMEOUT;
+
+            break;
+        }
+    }
+    (void)__atomic_fetch_sub(waiters, 1u, __ATOMIC_SEQ_CST);
+
+    return (error);
+}
+
+static void indexWake(
+    uint32_t *          index) {
+
+    (void)syscall(SYS_futex, index, FUTEX_WAKE | FUTEX_PRIVATE_FLAG, INT_MAX,
+        NULL, NULL, 0);
+}
+
+/*===================================  GLOBAL PRIVATE FUNCTION DEFINITIONS  ==*/
+/*====================================  GLOBAL PUBLIC FUNCTION DEFINITIONS  ==*/
+
+void esQpWaitInit(
+    struct esQpWait *   qp,
+    void **             buff,
+    size_t              size) {
+
+    ES_REQUIRE(ES_API_POINTER, qp != NULL);
+    ES_REQUIRE(ES_API_POINTER, buff != NULL);
+    ES_REQUIRE(ES_API_RANGE,   size != 0u);
+    ES_REQUIRE(ES_API_RANGE,   ES_IS_PWR2(size));
+    ES_REQUIRE(ES_API_RANGE,   size <= (UINT32_MAX / 2u));
+
+    qp->buff       = buff;
+    qp->mask       = (uint32_t)size - 1u;
+    qp->head       = 0u;
+    qp->getWaiters = 0u;
+    qp->tail       = 0u;
+    qp->putWaiters = 0u;
+}
+
+void esQpWaitTerm(
+    struct esQpWait *   qp) {
+
+    ES_REQUIRE(ES_API_POINTER, qp != NULL);
+    ES_REQUIRE(ES_API_USAGE,   qp->getWaiters == 0u);
+    ES_REQUIRE(ES_API_USAGE,   qp->putWaiters == 0u);
+
+    qp->buff = NULL;
+    qp->mask = 0u;
+    qp->head = 0u;
+    qp->tail = 0u;
+}
+
+/* 1)       Zero timeout makes this a non-blocking call.
+ * 2)       The index store and the waiters load must not be reordered, see
+ *          note 1 of indexWait().
+ */
+esError esQpPutWait(
+    struct esQpWait *   qp,
+    void *              item,
+    uint32_t            timeout) {
+
+    struct timespec     deadlineBuff;
+    const struct timespec * deadline;
+    uint32_t            head;
+    uint32_t            tail;
+    esError             error;
+
+    ES_REQUIRE(ES_API_POINTER, qp != NULL);
+    ES_REQUIRE(ES_API_POINTER, qp->buff != NULL);
+
+    head     = qp->head;
+    deadline = NULL;
+    tail     = __atomic_load_n(&qp->tail, __ATOMIC_ACQUIRE);
+
+    while ((head - tail) > qp->mask) {                                          /* Is the queue full?                                       */
+
+        if (timeout == 0u) {                                                    /* See note 1.                                              */
+
+            return (ES_ERROR_TIMEOUT);
+        }
+
+        if (deadline == NULL) {
+            deadline = deadlineInit(&deadlineBuff, timeout);
+        }
+        error = indexWait(&qp->tail, &qp->putWaiters, tail, deadline);
+
+        if (error != ES_ERROR_NONE) {
+
+            return (error);
+        }
+        tail = __atomic_load_n(&qp->tail, __ATOMIC_ACQUIRE);
+    }
+    qp->buff[head & qp->mask] = item;
+    __atomic_store_n(&qp->head, head + 1u, __ATOMIC_SEQ_CST);                   /* See note 2.                                              */
+
+    if (__atomic_load_n(&qp->getWaiters, __ATOMIC_SEQ_CST) != 0u) {
+        indexWake(&qp->head);
+    }
+
+    return (ES_ERROR_NONE);
+}
+
+esError esQpGetWait(
+    struct esQpWait *   qp,
+    void **             item,
+    uint32_t            timeout) {
+
+    struct timespec     deadlineBuff;
+    const struct timespec * deadline;
+    uint32_t            head;
+    uint32_t            tail;
+    esError             error;
+
+    ES_REQUIRE(ES_API_POINTER, qp != NULL);
+    ES_REQUIRE(ES_API_POINTER, qp->buff != NULL);
+    ES_REQUIRE(ES_API_POINTER, item != NULL);
+
+    tail     = qp->tail;
+    deadline = NULL;
+    head     = __atomic_load_n(&qp->head, __ATOMIC_ACQUIRE);
+
+    while (head == tail) {                                                      /* Is the queue empty?                                      */
+
+        if (timeout == 0u) {
+
+            return (ES_ERROR_TIMEOUT);
+        }
+
+        if (deadline == NULL) {
+            deadline = deadlineInit(&deadlineBuff, timeout);
+        }
+        error = indexWait(&qp->head, &qp->getWaiters, head, deadline);
+
+        if (error != ES_ERROR_NONE) {
+
+            return (error);
+        }
+        head = __atomic_load_n(&qp->head, __ATOMIC_ACQUIRE);
+    }
+    *item = qp->buff[tail & qp->mask];
+    __atomic_store_n(&qp->tail, tail + 1u, __ATOMIC_SEQ_CST);
+
+    if (__atomic_load_n(&qp->putWaiters, __ATOMIC_SEQ_CST) != 0u) {
+        indexWake(&qp->tail);
+    }
+
+    return (ES_ERROR_NONE);
+}
+
+/*================================*//** @cond *//*==  CONFIGURATION ERRORS  ==*/
+/** @endcond *//** @} *//******************************************************
+ * END of queue_wait.c
+ ******************************************************************************/
@@ -0,0 +1,168 @@
+/*
+ * This file is part of eSolid.
+ *
+ * Copyright (C) 2010 - 2013 Nenad Radulovic
+ *
+ * eSolid is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * eSolid is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with eSolid.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * web site:    http://github.com/nradulovic
+ * e-mail  :    nenad.b.radulovic@gmail.com
+ *//***********************************************************************//**
+ * @file
+ * @author      Nenad Radulovic
+ * @brief       Implementation of read-copy-update list port.
+ * @addtogroup  x86-64-linux-gcc-rcu_list
+ *********************************************************************//** @{ */
+
+/*=========================================================  INCLUDE FILES  ==*/
+
+#include <sched.h>
+
+#include "plat/compiler.h"
+#include "base/base.h"
+#include "base/debug.h"
+#include "arch/rcu_list.h"
+
+/*=========================================================  LOCAL MACRO's  ==*/
+/*======================================================  LOCAL DATA TYPES  ==*/
+/*=============================================  LOCAL FUNCTION PROTOTYPES  ==*/
+
+/**@brief       Reclaim a list of deferred headers
+ */
+static void reclaim(
+    struct esRcuHead *  head);
+
+/*=======================================================  LOCAL VARIABLES  ==*/
+
+static const ES_MODULE_INFO_CREATE("Rcu", "Read-copy-update list", "Nenad Radulovic");
+
+/*======================================================  GLOBAL VARIABLES  ==*/
+/*============================================  LOCAL FUNCTION DEFINITIONS  ==*/
+
+static void reclaim(
+    struct esRcuHead *  head) {
+
+    struct esRcuHead *  next;
+
+    while (head != NULL) {
+        next = head->next;
+        head->reclaim(head);
+        head = next;
+    }
+}
+
+/*===================================  GLOBAL PRIVATE FUNCTION DEFINITIONS  ==*/
+/*====================================  GLOBAL PUBLIC FUNCTION DEFINITIONS  ==*/
+
+/* 1)       Epoch zero marks an offline reader, so counting starts from one.
+ */
+void esRcuInit(
+    struct esRcu *      rcu) {
+
+    ES_REQUIRE(ES_API_POINTER, rcu != NULL);
+
+    rcu->epoch    = 1u;                                                         /* See note 1.                                              */
+    rcu->deferred = NULL;
+    rcu->readers  = NULL;
+    (void)pthread_mutex_init(&rcu->lock, NULL);
+}
+
+void esRcuTerm(
+    struct esRcu *      rcu) {
+
+    ES_REQUIRE(ES_API_POINTER, rcu != NULL);
+    ES_REQUIRE(ES_API_USAGE,   rcu->readers == NULL);
+
+    reclaim(rcu->deferred);
+    rcu->deferred = NULL;
+    (void)pthread_mutex_destroy(&rcu->lock);
+}
+
+void esRcuReaderRegister(
+    struct esRcu *      rcu,
+    struct esRcuReader * reader) {
+
+    ES_REQUIRE(ES_API_POINTER, rcu != NULL);
+    ES_REQUIRE(ES_API_POINTER, reader != NULL);
+
+    (void)pthread_mutex_lock(&rcu->lock);
+    reader->next = rcu->readers;
+    rcu->readers = reader;
+    esRcuOnline(rcu, reader);
+    (void)pthread_mutex_unlock(&rcu->lock);
+}
+
+void esRcuReaderUnregister(
+    struct esRcu *      rcu,
+    struct esRcuReader * reader) {
+
+    struct esRcuReader ** prev;
+
+    ES_REQUIRE(ES_API_POINTER, rcu != NULL);
+    ES_REQUIRE(ES_API_POINTER, reader != NULL);
+
+    esRcuOffline(reader);
+    (void)pthread_mutex_lock(&rcu->lock);
+
+    prev = &rcu->readers;
+
+    while ((*prev != NULL) && (*prev != reader)) {
+        prev = &(*prev)->next;
+    }
+    ES_REQUIRE(ES_API_USAGE, *prev != NULL);
+    *prev = reader->next;
+    (void)pthread_mutex_unlock(&rcu->lock);
+}
+
+/* 1)       Headers are taken before the epoch changes, so they were deferred
+ *          after their nodes were unlinked and before the grace period began.
+ * 2)       The release store makes the unlinks visible to readers which see
+ *          the new epoch. The full fence pairs with the fence in
+ *          @ref esRcuOnline: either the reader is seen online here or the
+ *          reader sees the unlinks.
+ * 3)       A reader which reports an older epoch may still hold a reference
+ *          to an unlinked node.
+ */
+void esRcuSynchronize(
+    struct esRcu *      rcu) {
+
+    struct esRcuHead *  deferred;
+    struct esRcuReader * reader;
+    uint64_t            epoch;
+    uint64_t            seen;
+
+    ES_REQUIRE(ES_API_POINTER, rcu != NULL);
+
+    (void)pthread_mutex_lock(&rcu->lock);
+    deferred = __atomic_exchange_n(&rcu->deferred, NULL, __ATOMIC_ACQUIRE);     /* See note 1.                                              */
+    epoch    = rcu->epoch + 1u;
+    __atomic_store_n(&rcu->epoch, epoch, __ATOMIC_RELEASE);                     /* See note 2.                                              */
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+
+    for (reader = rcu->readers; reader != NULL; reader = reader->next) {
+        seen = __atomic_load_n(&reader->epoch, __ATOMIC_ACQUIRE);
+
+        while ((seen != 0u) && (seen < epoch)) {                                /* See note 3.                                              */
+            (void)sched_yield();
+            seen = __atomic_load_n(&reader->epoch, __ATOMIC_ACQUIRE);
+        }
+    }
+    (void)pthread_mutex_unlock(&rcu->lock);
+    reclaim(deferred);
+}
+
+/*================================*//** @cond *//*==  CONFIGURATION ERRORS  ==*/
+/** @endcond *//** @} *//** @} *//*********************************************
+ * END of rcu_list.c
+ ******************************************************************************/
@@ -0,0 +1,267 @@
+/*
+ * This file is part of eSolid.
+ *
+ * Copyright (C) 2010 - 2013 Nenad Radulovic
+ *
+ * eSolid is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * eSolid is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with eSolid.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * web site:    http://github.com/nradulovic
+ * e-mail  :    nenad.b.radulovic@gmail.com
+ *//***********************************************************************//**
+ * @file
+ * @author      Nenad Radulovic
+ * @brief       Implementation of shared memory queue port.
+ * @addtogroup  x86-64-linux-gcc-shm_queue
+ *********************************************************************//** @{ */
+
+/*=========================================================  INCLUDE FILES  ==*/
+
+#if !defined(_GNU_SOURCE)
+# define _GNU_SOURCE                                                            /* Needed for memfd_create()                                */
+#endif
+
+#include <stdint.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "plat/compiler.h"
+#include "base/base.h"
+#include "base/debug.h"
+#include "base/bitop.h"
+#include "arch/shm_queue.h"
+
+/*=========================================================  LOCAL MACRO's  ==*/
+
+/**@brief       Value of header magic field
+ */
+#define SHM_QP_MAGIC                    ((uint32_t)0xdeedbef2ul)
+
+/**@brief       Offset of the first slot from the beginning of object
+ */
+#define SHM_QP_SLOT_OFFSET                                                      \
+    ES_ALIGN_UP(sizeof(struct esShmQpHdr), ES_SHM_QP_CACHE_LINE)
+
+/*======================================================  LOCAL DATA TYPES  ==*/
+/*=============================================  LOCAL FUNCTION PROTOTYPES  ==*/
+
+/**@brief       Map the shared memory object and fill in the queue structure
+ * @param       qp
+ *              Pointer to shared memory queue
+ * @param       fd
+ *              Descriptor of shared memory object, it is owned by the queue
+ * @param       mapSize
+ *              Size of mapping in bytes
+ * @return      Operation status
+ */
+static esError shmMap(
+    struct esShmQp *    qp,
+    int                 fd,
+    size_t              mapSize);
+
+/*=======================================================  LOCAL VARIABLES  ==*/
+
+static const ES_MODULE_INFO_CREATE("Shm queue", "Shared memory queue", "Nenad Radulovic");
+
+/*======================================================  GLOBAL VARIABLES  ==*/
+/*============================================  LOCAL FUNCTION DEFINITIONS  ==*/
+
+static esError shmMap(
+    struct esShmQp *    qp,
+    int                 fd,
+    size_t              mapSize) {
+
+    void *              base;
+
+    base = mmap(NULL, mapSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+
+    if (base == MAP_FAILED) {
+        (void)close(fd);
+
+        return (ES_ERROR_NO_MEMORY);
+    }
+    qp->hdr     = (struct esShmQpHdr *)base;
+    qp->slot    = (uint8_t *)base + SHM_QP_SLOT_OFFSET;
+    qp->mapSize = mapSize;
+    qp->fd      = fd;
+
+    return (ES_ERROR_NONE);
+}
+
+/*===================================  GLOBAL PRIVATE FUNCTION DEFINITIONS  ==*/
+/*====================================  GLOBAL PUBLIC FUNCTION DEFINITIONS  ==*/
+
+/* 1)       A new object is filled with zeros, so the indexes need not be
+ *          initialized. The magic is stored last, with release semantics, so
+ *          a process which sees the magic also sees the rest of header.
+ */
+esError esShmQpCreate(
+    struct esShmQp *    qp,
+    const char *        name,
+    size_t              size,
+    size_t              slotSize) {
+
+    int                 fd;
+    size_t              mapSize;
+    esError             error;
+
+    ES_REQUIRE(ES_API_POINTER, qp != NULL);
+    ES_REQUIRE(ES_API_RANGE,   size != 0u);
+    ES_REQUIRE(ES_API_RANGE,   ES_IS_PWR2(size));
+    ES_REQUIRE(ES_API_RANGE,   size <= (UINT32_MAX / 2u));
+    ES_REQUIRE(ES_API_RANGE,   slotSize != 0u);
+
+    slotSize = ES_ALIGN_UP(slotSize, ES_CPU_DEF_DATA_ALIGNMENT);
+    mapSize  = SHM_QP_SLOT_OFFSET + (size * slotSize);
+
+    if (name == NULL) {
+        fd = memfd_create("esShmQp", 0);
+    } else {
+        fd = shm_open(name, O_RDWR | O_CREAT | O_EXCL | O_CLOEXEC, S_IRUSR | S_IWUSR);
+    }
+
+    if (fd == -1) {
+
+        return (ES_ERROR_NO_RESOURCE);
+    }
+
+    if (ftruncate(fd, (off_t)mapSize) != 0) {
+        (void)close(fd);
+
+        if (name != NULL) {
+            (void)shm_unlink(name);
+        }
+
+        return (ES_ERROR_NO_MEMORY);
+    }
+    error = shmMap(qp, fd, mapSize);
+
+    if (error != ES_ERROR_NONE) {
+
+        if (name != NULL) {
+            (void)shm_unlink(name);
+        }
+
+        return (error);
+    }
+    qp->mask          = (uint32_t)size - 1u;
+    qp->slotSize      = (uint32_t)slotSize;
+    qp->head          = 0u;
+    qp->tail          = 0u;
+    qp->hdr->mask     = qp->mask;                                               /* See note 1.                                              */
+    qp->hdr->slotSize = qp->slotSize;
+    __atomic_store_n(&qp->hdr->magic, SHM_QP_MAGIC, __ATOMIC_RELEASE);
+
+    return (ES_ERROR_NONE);
+}
+
+esError esShmQpOpen(
+    struct esShmQp *    qp,
+    const char *        name) {
+
+    int                 fd;
+    esError             error;
+
+    ES_REQUIRE(ES_API_POINTER, qp != NULL);
+    ES_REQUIRE(ES_API_POINTER, name != NULL);
+
+    fd = shm_open(name, O_RDWR | O_CLOEXEC, 0);
+
+    if (fd == -1) {
+
+        return (ES_ERROR_OBJECT_NFOUND);
+    }
+    error = esShmQpOpenFd(qp, fd);
+    (void)close(fd);
+
+    return (error);
+}
+
+/* 1)       The object size is checked against the header before any slot is
+ *          touched, so a damaged or foreign object can not make the process
+ *          access memory past the mapping.
+ */
+esError esShmQpOpenFd(
+    struct esShmQp *    qp,
+    int                 fd) {
+
+    struct stat         info;
+    size_t              mapSize;
+    esError             error;
+
+    ES_REQUIRE(ES_API_POINTER, qp != NULL);
+    ES_REQUIRE(ES_API_RANGE,   fd >= 0);
+
+    if ((fstat(fd, &info) != 0) || ((size_t)info.st_size < SHM_QP_SLOT_OFFSET)) {
+
+        return (ES_ERROR_OBJECT_INVALID);
+    }
+    fd = fcntl(fd, F_DUPFD_CLOEXEC, 0);
+
+    if (fd == -1) {
+
+        return (ES_ERROR_NO_RESOURCE);
+    }
+    mapSize = (size_t)info.st_size;
+    error   = shmMap(qp, fd, mapSize);
+
+    if (error != ES_ERROR_NONE) {
+
+        return (error);
+    }
+
+    if ((__atomic_load_n(&qp->hdr->magic, __ATOMIC_ACQUIRE) != SHM_QP_MAGIC) ||
+        (qp->hdr->slotSize == 0u) ||
+        (ES_IS_PWR2((size_t)qp->hdr->mask + 1u) == false) ||
+        (mapSize < (SHM_QP_SLOT_OFFSET +
+            (((size_t)qp->hdr->mask + 1u) * qp->hdr->slotSize)))) {             /* See note 1.                                              */
+        esShmQpClose(qp);
+
+        return (ES_ERROR_OBJECT_INVALID);
+    }
+    qp->mask     = qp->hdr->mask;
+    qp->slotSize = qp->hdr->slotSize;
+    qp->head     = __atomic_load_n(&qp->hdr->head, __ATOMIC_ACQUIRE);
+    qp->tail     = __atomic_load_n(&qp->hdr->tail, __ATOMIC_ACQUIRE);
+
+    return (ES_ERROR_NONE);
+}
+
+void esShmQpClose(
+    struct esShmQp *    qp) {
+
+    ES_REQUIRE(ES_API_POINTER, qp != NULL);
+    ES_REQUIRE(ES_API_OBJECT,  qp->hdr != NULL);
+
+    (void)munmap(qp->hdr, qp->mapSize);
+    (void)close(qp->fd);
+    qp->hdr     = NULL;
+    qp->slot    = NULL;
+    qp->mapSize = 0u;
+    qp->fd      = -1;
+}
+
+void esShmQpUnlink(
+    const char *        name) {
+
+    ES_REQUIRE(ES_API_POINTER, name != NULL);
+
+    (void)shm_unlink(name);
+}
+
+/*================================*//** @cond *//*==  CONFIGURATION ERRORS  ==*/
+/** @endcond *//** @} *//******************************************************
+ * END of shm_queue.c
+ ******************************************************************************/
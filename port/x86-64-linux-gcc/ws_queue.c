@@ -0,0 +1,153 @@
+/*
+ * This file is part of eSolid.
+ *
+ * Copyright (C) 2010 - 2013 Nenad Radulovic
+ *
+ * eSolid is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * eSolid is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with eSolid.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * web site:    http://github.com/nradulovic
+ * e-mail  :    nenad.b.radulovic@gmail.com
+ *//***********************************************************************//**
+ * @file
+ * @author      Nenad Radulovic
+ * @brief       Implementation of work stealing queue port.
+ * @addtogroup  x86-64-linux-gcc-ws_queue
+ *********************************************************************//** @{ */
+
+/*=========================================================  INCLUDE FILES  ==*/
+
+#include <stdlib.h>
+
+#include "plat/compiler.h"
+#include "base/base.h"
+#include "base/debug.h"
+#include "base/bitop.h"
+#include "arch/ws_queue.h"
+
+/*=========================================================  LOCAL MACRO's  ==*/
+/*======================================================  LOCAL DATA TYPES  ==*/
+/*=============================================  LOCAL FUNCTION PROTOTYPES  ==*/
+
+/**@brief       Allocate an array
+ * @param       size
+ *              Number of elements, a power of two
+ * @return      Pointer to array or NULL when there is no memory
+ */
+static struct esWsqArray * arrayAlloc(
+    size_t              size);
+
+/*=======================================================  LOCAL VARIABLES  ==*/
+
+static const ES_MODULE_INFO_CREATE("Wsq", "Work stealing queue", "Nenad Radulovic");
+
+/*======================================================  GLOBAL VARIABLES  ==*/
+/*============================================  LOCAL FUNCTION DEFINITIONS  ==*/
+
+static struct esWsqArray * arrayAlloc(
+    size_t              size) {
+
+    struct esWsqArray * array;
+
+    array = malloc(sizeof(struct esWsqArray) + (size * sizeof(void *)));
+
+    if (array != NULL) {
+        array->next = NULL;
+        array->mask = (int64_t)size - 1;
+    }
+
+    return (array);
+}
+
+/*===================================  GLOBAL PRIVATE FUNCTION DEFINITIONS  ==*/
+
+/* 1)       Only the owner changes the array and the bottom index, so the items
+ *          between top and bottom can be copied without synchronization. Top
+ *          may move forward meanwhile, which only means that some copied items
+ *          are already stolen.
+ * 2)       A thief which has loaded the old array may still read from it, so
+ *          the array is not freed here.
+ */
+esError esWsqGrow_(
+    struct esWsq *      wsq,
+    int64_t             top,
+    int64_t             bottom) {
+
+    struct esWsqArray * old;
+    struct esWsqArray * array;
+    int64_t             cnt;
+
+    old   = wsq->array;
+    array = arrayAlloc(((size_t)old->mask + 1u) * 2u);
+
+    if (array == NULL) {
+
+        return (ES_ERROR_NO_MEMORY);
+    }
+
+    for (cnt = top; cnt < bottom; cnt++) {                                      /* See note 1.                                              */
+        array->buff[cnt & array->mask] = old->buff[cnt & old->mask];
+    }
+    __atomic_store_n(&wsq->array, array, __ATOMIC_RELEASE);
+    old->next    = wsq->retired;                                                /* See note 2.                                              */
+    wsq->retired = old;
+
+    return (ES_ERROR_NONE);
+}
+
+/*====================================  GLOBAL PUBLIC FUNCTION DEFINITIONS  ==*/
+
+esError esWsqInit(
+    struct esWsq *      wsq,
+    size_t              size) {
+
+    ES_REQUIRE(ES_API_POINTER, wsq != NULL);
+    ES_REQUIRE(ES_API_RANGE,   size != 0u);
+    ES_REQUIRE(ES_API_RANGE,   ES_IS_PWR2(size));
+
+    wsq->top     = 0;
+    wsq->bottom  = 0;
+    wsq->retired = NULL;
+    wsq->array   = arrayAlloc(size);
+
+    if (wsq->array == NULL) {
+
+        return (ES_ERROR_NO_MEMORY);
+    }
+
+    return (ES_ERROR_NONE);
+}
+
+void esWsqTerm(
+    struct esWsq *      wsq) {
+
+    struct esWsqArray * array;
+
+    ES_REQUIRE(ES_API_POINTER, wsq != NULL);
+    ES_REQUIRE(ES_API_OBJECT,  wsq->array != NULL);
+
+    while (wsq->retired != NULL) {
+        array        = wsq->retired;
+        wsq->retired = array->next;
+        free(array);
+    }
+    free(wsq->array);
+    wsq->array  = NULL;
+    wsq->top    = 0;
+    wsq->bottom = 0;
+}
+
+/*================================*//** @cond *//*==  CONFIGURATION ERRORS  ==*/
+/** @endcond *//** @} *//******************************************************
+ * END of ws_queue.c
+ ******************************************************************************/
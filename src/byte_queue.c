@@ -0,0 +1,258 @@
+/*
+ * This file is part of eSolid.
+ *
+ * Copyright (C) 2010 - 2013 Nenad Radulovic
+ *
+ * eSolid is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * eSolid is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with eSolid.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * web site:    http://github.com/nradulovic
+ * e-mail  :    nenad.b.radulovic@gmail.com
+ *//***********************************************************************//**
+ * @file
+ * @author      Nenad Radulovic
+ * @brief       Byte record queue implementation
+ * @addtogroup  base_byte_queue
+ *********************************************************************//** @{ */
+/**@defgroup    base_byte_queue_impl Implementation
+ * @brief       Byte record queue Implementation
+ * @{ *//*--------------------------------------------------------------------*/
+
+/*=========================================================  INCLUDE FILES  ==*/
+
+#include <stddef.h>
+
+#include "base/base.h"
+#include "base/byte_queue.h"
+
+/*=========================================================  LOCAL MACRO's  ==*/
+
+/**@brief       Byte queue signature
+ */
+#define QB_SIGNATURE                    ((esAtomic)0xdeedbeeeul)
+
+/**@brief       Size of record header
+ */
+#define QB_HDR_SIZE                     ES_QB_SIZEOF(0u)
+
+/**@brief       Record header value which marks skipped space at buffer end
+ */
+#define QB_SKIP_MARK                    UINT32_MAX
+
+/**@brief       Get the record header at the given position
+ */
+#define QB_HDR(qb, pos)                                                         \
+    ((uint32_t *)&(qb)->buff[(pos)])
+
+/*======================================================  LOCAL DATA TYPES  ==*/
+/*=============================================  LOCAL FUNCTION PROTOTYPES  ==*/
+
+/**@brief       Get the position of the oldest record
+ * @param       qb
+ *              Pointer to byte record queue
+ * @param       skip
+ *              Pointer to variable which will receive the number of skipped
+ *              bytes at the end of buffer
+ * @return      Position of the oldest record header in the buffer
+ */
+static PORT_C_INLINE uint32_t recordTail(
+    const struct esQb * qb,
+    uint32_t *          skip);
+
+/*=======================================================  LOCAL VARIABLES  ==*/
+
+static const ES_MODULE_INFO_CREATE("Byte queue", "Byte record queue", "Nenad Radulovic");
+
+/*======================================================  GLOBAL VARIABLES  ==*/
+/*============================================  LOCAL FUNCTION DEFINITIONS  ==*/
+
+static PORT_C_INLINE uint32_t recordTail(
+    const struct esQb * qb,
+    uint32_t *          skip) {
+
+    if ((qb->isMirrored == false) && (*QB_HDR(qb, qb->tail) == QB_SKIP_MARK)) {
+        *skip = qb->size - qb->tail;
+
+        return (0u);
+    } else {
+        *skip = 0u;
+
+        return (qb->tail);
+    }
+}
+
+/*===================================  GLOBAL PRIVATE FUNCTION DEFINITIONS  ==*/
+/*====================================  GLOBAL PUBLIC FUNCTION DEFINITIONS  ==*/
+
+void esQbInit(
+    struct esQb *       qb,
+    void *              buff,
+    size_t              size) {
+
+    ES_REQUIRE(ES_API_POINTER, qb != NULL);
+    ES_REQUIRE(ES_API_OBJECT,  qb->signature != QB_SIGNATURE);
+    ES_REQUIRE(ES_API_POINTER, buff != NULL);
+    ES_REQUIRE(ES_API_RANGE,   ((uintptr_t)buff % ES_QB_ALIGNMENT) == 0u);
+    ES_REQUIRE(ES_API_RANGE,   (size % ES_QB_ALIGNMENT) == 0u);
+    ES_REQUIRE(ES_API_RANGE,   size >= ES_QB_SIZEOF(1u));
+    ES_REQUIRE(ES_API_RANGE,   size < UINT32_MAX);
+
+    qb->buff       = (uint8_t *)buff;
+    qb->head       = 0u;
+    qb->tail       = 0u;
+    qb->free       = (uint32_t)size;
+    qb->size       = (uint32_t)size;
+    qb->reserved   = 0u;
+    qb->isMirrored = false;
+    ES_OBLIGATION(qb->signature = QB_SIGNATURE);
+}
+
+void esQbInitMirrored(
+    struct esQb *       qb,
+    void *              buff,
+    size_t              size) {
+
+    esQbInit(
+        qb,
+        buff,
+        size);
+    qb->isMirrored = true;
+}
+
+void esQbTerm(
+    struct esQb *       qb) {
+
+    ES_REQUIRE(ES_API_POINTER, qb != NULL);
+    ES_REQUIRE(ES_API_OBJECT,  qb->signature == QB_SIGNATURE);
+
+    qb->buff       = NULL;
+    qb->head       = 0u;
+    qb->tail       = 0u;
+    qb->free       = 0u;
+    qb->size       = 0u;
+    qb->reserved   = 0u;
+    qb->isMirrored = false;
+    ES_OBLIGATION(qb->signature = ~QB_SIGNATURE);
+}
+
+/* 1)       When the queue is empty both positions are rewound to the beginning
+ *          of buffer so the largest possible record can be reserved.
+ * 2)       Record headers are written into free space, so they are not visible
+ *          to consumer until the record is committed.
+ */
+void * esQbReserve(
+    struct esQb *       qb,
+    size_t              length) {
+
+    uint32_t            need;
+    uint32_t            pos;
+
+    ES_REQUIRE(ES_API_POINTER, qb != NULL);
+    ES_REQUIRE(ES_API_OBJECT,  qb->signature == QB_SIGNATURE);
+    ES_REQUIRE(ES_API_USAGE,   qb->reserved == 0u);
+
+    if (length > (size_t)(qb->size - QB_HDR_SIZE)) {
+
+        return (NULL);
+    }
+    need = (uint32_t)ES_QB_SIZEOF(length);
+
+    if (need > qb->free) {
+
+        return (NULL);
+    }
+
+    if (qb->free == qb->size) {                                                 /* See note 1.                                              */
+        qb->head = 0u;
+        qb->tail = 0u;
+    }
+
+    if ((qb->isMirrored == true) || (qb->head < qb->tail) ||
+        (need <= (qb->size - qb->head))) {                                      /* Does the record fit at the current write position?       */
+        pos          = qb->head;
+        qb->reserved = need;
+    } else if (need <= qb->tail) {                                              /* No: does it fit at the beginning of buffer?              */
+        *QB_HDR(qb, qb->head) = QB_SKIP_MARK;                                   /* See note 2.                                              */
+        pos          = 0u;
+        qb->reserved = need + (qb->size - qb->head);
+    } else {
+
+        return (NULL);
+    }
+    *QB_HDR(qb, pos) = (uint32_t)length;                                        /* See note 2.                                              */
+
+    return (&qb->buff[pos + QB_HDR_SIZE]);
+}
+
+void esQbCommit(
+    struct esQb *       qb) {
+
+    ES_REQUIRE(ES_API_POINTER, qb != NULL);
+    ES_REQUIRE(ES_API_OBJECT,  qb->signature == QB_SIGNATURE);
+    ES_REQUIRE(ES_API_USAGE,   qb->reserved != 0u);
+
+    qb->head += qb->reserved;
+
+    if (qb->head >= qb->size) {
+        qb->head -= qb->size;
+    }
+    qb->free    -= qb->reserved;
+    qb->reserved = 0u;
+}
+
+void * esQbPeek(
+    const struct esQb * qb,
+    size_t *            length) {
+
+    uint32_t            pos;
+    uint32_t            skip;
+
+    ES_REQUIRE(ES_API_POINTER, qb != NULL);
+    ES_REQUIRE(ES_API_OBJECT,  qb->signature == QB_SIGNATURE);
+    ES_REQUIRE(ES_API_POINTER, length != NULL);
+
+    if (qb->free == qb->size) {
+
+        return (NULL);
+    }
+    pos     = recordTail(qb, &skip);
+    *length = (size_t)*QB_HDR(qb, pos);
+
+    return (&qb->buff[pos + QB_HDR_SIZE]);
+}
+
+void esQbRelease(
+    struct esQb *       qb) {
+
+    uint32_t            pos;
+    uint32_t            skip;
+    uint32_t            consumed;
+
+    ES_REQUIRE(ES_API_POINTER, qb != NULL);
+    ES_REQUIRE(ES_API_OBJECT,  qb->signature == QB_SIGNATURE);
+    ES_REQUIRE(ES_API_USAGE,   qb->free != qb->size);
+
+    pos      = recordTail(qb, &skip);
+    consumed = (uint32_t)ES_QB_SIZEOF(*QB_HDR(qb, pos));
+    qb->tail = pos + consumed;
+
+    if (qb->tail >= qb->size) {
+        qb->tail -= qb->size;
+    }
+    qb->free += skip + consumed;
+}
+
+/*================================*//** @cond *//*==  CONFIGURATION ERRORS  ==*/
+/** @endcond *//** @} *//** @} *//*********************************************
+ * END of byte_queue.c
+ ******************************************************************************/
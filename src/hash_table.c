@@ -0,0 +1,296 @@
+/*
+ * This file is part of eSolid.
+ *
+ * Copyright (C) 2010 - 2013 Nenad Radulovic
+ *
+ * eSolid is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * eSolid is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with eSolid.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * web site:    http://github.com/nradulovic
+ * e-mail  :    nenad.b.radulovic@gmail.com
+ *//***********************************************************************//**
+ * @file
+ * @author      Nenad Radulovic
+ * @brief       Hash table implementation
+ * @addtogroup  base_hash_table
+ *********************************************************************//** @{ */
+/**@defgroup    base_hash_table_impl Implementation
+ * @brief       Hash table Implementation
+ * @{ *//*--------------------------------------------------------------------*/
+
+/*=========================================================  INCLUDE FILES  ==*/
+
+#include <stddef.h>
+
+#include "base/base.h"
+#include "base/bitop.h"
+#include "base/hash_table.h"
+
+/*=========================================================  LOCAL MACRO's  ==*/
+
+/**@brief       Hash table signature
+ */
+#define HT_SIGNATURE                    ((esAtomic)0xdeedbef6ul)
+
+/*======================================================  LOCAL DATA TYPES  ==*/
+/*=============================================  LOCAL FUNCTION PROTOTYPES  ==*/
+
+/**@brief       Allocate and initialize bucket array
+ * @return      Operation status
+ */
+static esError bucketsAlloc(
+    const struct esAllocator * allocator,
+    struct esHtBuckets * buckets,
+    size_t              size);
+
+static void bucketsFree(
+    const struct esAllocator * allocator,
+    struct esHtBuckets * buckets);
+
+/**@brief       Find a node in one bucket array
+ */
+static struct esHtNode * bucketsFind(
+    const struct esHt * ht,
+    const struct esHtBuckets * buckets,
+    uint32_t            hash,
+    const void *        key);
+
+/**@brief       Move a few old buckets to the current bucket array
+ */
+static void migrate(
+    struct esHt *       ht);
+
+/*=======================================================  LOCAL VARIABLES  ==*/
+
+static const ES_MODULE_INFO_CREATE("Hash table", "Hash table", "Nenad Radulovic");
+
+/*======================================================  GLOBAL VARIABLES  ==*/
+/*============================================  LOCAL FUNCTION DEFINITIONS  ==*/
+
+static esError bucketsAlloc(
+    const struct esAllocator * allocator,
+    struct esHtBuckets * buckets,
+    size_t              size) {
+
+    size_t              cnt;
+
+    buckets->bucket = esAllocatorAlloc(allocator, size * sizeof(struct esDls));
+
+    if (buckets->bucket == NULL) {
+
+        return (ES_ERROR_NO_MEMORY);
+    }
+    buckets->mask = (uint32_t)size - 1u;
+
+    for (cnt = 0u; cnt < size; cnt++) {
+        esDlsSentinelInit(
+            &buckets->bucket[cnt]);
+    }
+
+    return (ES_ERROR_NONE);
+}
+
+static void bucketsFree(
+    const struct esAllocator * allocator,
+    struct esHtBuckets * buckets) {
+
+    esAllocatorFree(allocator, buckets->bucket, ((size_t)buckets->mask + 1u) * sizeof(struct esDls));
+    buckets->bucket = NULL;
+    buckets->mask   = 0u;
+}
+
+static struct esHtNode * bucketsFind(
+    const struct esHt * ht,
+    const struct esHtBuckets * buckets,
+    uint32_t            hash,
+    const void *        key) {
+
+    struct esDls *      sentinel;
+    struct esDls *      current;
+    struct esHtNode *   node;
+
+    sentinel = &buckets->bucket[hash & buckets->mask];
+
+    for (current = sentinel->next; current != sentinel; current = current->next) {
+        node = ES_DLS_NODE_ENTRY(struct esHtNode, list, current);
+
+        if ((node->hash == hash) && (ht->equal(node, key) == true)) {
+
+            return (node);
+        }
+    }
+
+    return (NULL);
+}
+
+/* 1)       Node hash is stored in the node, so moving does not call the hash
+ *          function.
+ */
+static void migrate(
+    struct esHt *       ht) {
+
+    uint32_t            step;
+    struct esDls *      sentinel;
+    struct esHtNode *   node;
+
+    for (step = 0u; step < CONFIG_HT_MIGRATE_STEP; step++) {
+        sentinel = &ht->old.bucket[ht->migrate];
+
+        while (esDlsIsEmpty(sentinel) == false) {
+            node = ES_DLS_NODE_ENTRY(struct esHtNode, list, sentinel->next);
+            esDlsNodeRm(
+                &node->list);
+            esDlsNodeAddHead(
+                &ht->table.bucket[node->hash & ht->table.mask],                 /* See note 1.                                              */
+                &node->list);
+        }
+
+        if (ht->migrate == ht->old.mask) {                                      /* Was this the last old bucket?                            */
+            bucketsFree(ht->allocator, &ht->old);
+            ht->migrate = 0u;
+
+            return;
+        }
+        ht->migrate++;
+    }
+}
+
+/*===================================  GLOBAL PRIVATE FUNCTION DEFINITIONS  ==*/
+/*====================================  GLOBAL PUBLIC FUNCTION DEFINITIONS  ==*/
+
+esError esHtInit(
+    struct esHt *       ht,
+    const struct esAllocator * allocator,
+    esHtHash            hash,
+    esHtEqual           equal,
+    size_t              size) {
+
+    esError             error;
+
+    ES_REQUIRE(ES_API_POINTER, ht != NULL);
+    ES_REQUIRE(ES_API_OBJECT,  ht->signature != HT_SIGNATURE);
+    ES_REQUIRE(ES_API_POINTER, allocator != NULL);
+    ES_REQUIRE(ES_API_POINTER, hash != NULL);
+    ES_REQUIRE(ES_API_POINTER, equal != NULL);
+    ES_REQUIRE(ES_API_RANGE,   size != 0u);
+    ES_REQUIRE(ES_API_RANGE,   ES_IS_PWR2(size));
+    ES_REQUIRE(ES_API_RANGE,   size <= (UINT32_MAX / 2u));
+
+    error = bucketsAlloc(allocator, &ht->table, size);
+
+    if (error != ES_ERROR_NONE) {
+
+        return (error);
+    }
+    ht->old.bucket = NULL;
+    ht->old.mask   = 0u;
+    ht->migrate    = 0u;
+    ht->count      = 0u;
+    ht->hash       = hash;
+    ht->equal      = equal;
+    ht->allocator  = allocator;
+    ES_OBLIGATION(ht->signature = HT_SIGNATURE);
+
+    return (ES_ERROR_NONE);
+}
+
+void esHtTerm(
+    struct esHt *       ht) {
+
+    ES_REQUIRE(ES_API_POINTER, ht != NULL);
+    ES_REQUIRE(ES_API_OBJECT,  ht->signature == HT_SIGNATURE);
+
+    if (ht->old.bucket != NULL) {
+        bucketsFree(ht->allocator, &ht->old);
+    }
+    bucketsFree(ht->allocator, &ht->table);
+    ht->count     = 0u;
+    ht->allocator = NULL;
+    ES_OBLIGATION(ht->signature = ~HT_SIGNATURE);
+}
+
+/* 1)       A new resize starts only after the previous one has moved all old
+ *          buckets. The bucket array size is limited so that the mask fits
+ *          into 32 bits.
+ */
+void esHtInsert(
+    struct esHt *       ht,
+    struct esHtNode *   node,
+    const void *        key) {
+
+    struct esHtBuckets  table;
+
+    ES_REQUIRE(ES_API_POINTER, ht != NULL);
+    ES_REQUIRE(ES_API_OBJECT,  ht->signature == HT_SIGNATURE);
+    ES_REQUIRE(ES_API_POINTER, node != NULL);
+
+    if (ht->old.bucket != NULL) {
+        migrate(ht);
+    } else if ((ht->count > ht->table.mask) && (ht->table.mask < (UINT32_MAX / 4u))) {
+
+        if (bucketsAlloc(ht->allocator, &table, ((size_t)ht->table.mask + 1u) * 2u) == ES_ERROR_NONE) {
+            ht->old     = ht->table;                                            /* See note 1.                                              */
+            ht->table   = table;
+            ht->migrate = 0u;
+            migrate(ht);
+        }
+    }
+    node->hash = ht->hash(key);
+    esDlsNodeAddHead(
+        &ht->table.bucket[node->hash & ht->table.mask],
+        &node->list);
+    ht->count++;
+}
+
+void esHtRemove(
+    struct esHt *       ht,
+    struct esHtNode *   node) {
+
+    ES_REQUIRE(ES_API_POINTER, ht != NULL);
+    ES_REQUIRE(ES_API_OBJECT,  ht->signature == HT_SIGNATURE);
+    ES_REQUIRE(ES_API_POINTER, node != NULL);
+    ES_REQUIRE(ES_API_USAGE,   ht->count != 0u);
+
+    esDlsNodeRm(
+        &node->list);
+    ht->count--;
+
+    if (ht->old.bucket != NULL) {
+        migrate(ht);
+    }
+}
+
+struct esHtNode * esHtFind(
+    const struct esHt * ht,
+    const void *        key) {
+
+    uint32_t            hash;
+    struct esHtNode *   node;
+
+    ES_REQUIRE(ES_API_POINTER, ht != NULL);
+    ES_REQUIRE(ES_API_OBJECT,  ht->signature == HT_SIGNATURE);
+
+    hash = ht->hash(key);
+    node = bucketsFind(ht, &ht->table, hash, key);
+
+    if ((node == NULL) && (ht->old.bucket != NULL)) {
+        node = bucketsFind(ht, &ht->old, hash, key);
+    }
+
+    return (node);
+}
+
+/*================================*//** @cond *//*==  CONFIGURATION ERRORS  ==*/
+/** @endcond *//** @} *//** @} *//*********************************************
+ * END of hash_table.c
+ ******************************************************************************/
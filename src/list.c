@@ -0,0 +1,165 @@
+/*
+ * This file is part of eSolid.
+ *
+ * Copyright (C) 2010 - 2013 Nenad Radulovic
+ *
+ * eSolid is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * eSolid is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with eSolid.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * web site:    http://github.com/nradulovic
+ * e-mail  :    nenad.b.radulovic@gmail.com
+ *//***********************************************************************//**
+ * @file
+ * @author      Nenad Radulovic
+ * @brief       Linked lists implementation
+ * @addtogroup  base_list
+ *********************************************************************//** @{ */
+
+/*=========================================================  INCLUDE FILES  ==*/
+
+#include <stddef.h>
+
+#include "base/base.h"
+#include "base/debug.h"
+#include "base/list.h"
+
+/*=========================================================  LOCAL MACRO's  ==*/
+
+/**@brief       Number of merge sort bins
+ * @details     Bin @c n holds a sorted run of 2^n nodes, so this is enough for
+ *              any list which fits into memory.
+ */
+#define DLS_SORT_BINS                   (sizeof(void *) * 8u)
+
+/*======================================================  LOCAL DATA TYPES  ==*/
+/*=============================================  LOCAL FUNCTION PROTOTYPES  ==*/
+
+/**@brief       Merge two sorted runs linked by @c next and terminated by NULL
+ * @param       first
+ *              Run of nodes which were earlier in the list
+ * @param       second
+ *              Run of nodes which were later in the list
+ * @param       compare
+ *              Node compare function
+ * @return      The merged run. Equal nodes are taken from @c first run first,
+ *              which makes the sort stable.
+ */
+static esDls * dlsMerge(
+    esDls *             first,
+    esDls *             second,
+    esDlsCompare        compare);
+
+/*=======================================================  LOCAL VARIABLES  ==*/
+
+static const ES_MODULE_INFO_CREATE("List", "Linked lists", "Nenad Radulovic");
+
+/*======================================================  GLOBAL VARIABLES  ==*/
+/*============================================  LOCAL FUNCTION DEFINITIONS  ==*/
+
+static esDls * dlsMerge(
+    esDls *             first,
+    esDls *             second,
+    esDlsCompare        compare) {
+
+    esDls               head;
+    esDls *             tail;
+
+    tail = &head;
+
+    while ((first != NULL) && (second != NULL)) {
+
+        if (compare(second, first) < 0) {
+            tail->next = second;
+            second     = second->next;
+        } else {
+            tail->next = first;
+            first      = first->next;
+        }
+        tail = tail->next;
+    }
+    tail->next = (first != NULL) ? first : second;
+
+    return (head.next);
+}
+
+/*===================================  GLOBAL PRIVATE FUNCTION DEFINITIONS  ==*/
+/*====================================  GLOBAL PUBLIC FUNCTION DEFINITIONS  ==*/
+
+/* 1)       The list is unlinked into NULL terminated runs which use only the
+ *          @c next pointer. Each node is merged into bins like a binary
+ *          counter: bin @c n is either empty or holds 2^n nodes which were in
+ *          the list before all nodes in lower bins.
+ * 2)       Higher bins hold earlier nodes, so they are merged as the first
+ *          argument to keep the sort stable.
+ * 3)       The @c prev pointers are restored in one pass over sorted run.
+ */
+void esDlsSort(
+    esDls *             sentinel,
+    esDlsCompare        compare) {
+
+    esDls *             bin[DLS_SORT_BINS];
+    esDls *             node;
+    esDls *             carry;
+    esDls *             prev;
+    uint_fast8_t        fill;
+    uint_fast8_t        cnt;
+
+    ES_REQUIRE(ES_API_POINTER, sentinel != NULL);
+    ES_REQUIRE(ES_API_POINTER, compare != NULL);
+
+    if (sentinel->next == sentinel->prev) {                                     /* Lists with less than two nodes are sorted                */
+
+        return;
+    }
+    sentinel->prev->next = NULL;                                                /* See note 1.                                              */
+    node = sentinel->next;
+    fill = 0u;
+
+    while (node != NULL) {
+        carry       = node;
+        node        = node->next;
+        carry->next = NULL;
+
+        for (cnt = 0u; (cnt < fill) && (bin[cnt] != NULL); cnt++) {
+            carry    = dlsMerge(bin[cnt], carry, compare);                      /* See note 2.                                              */
+            bin[cnt] = NULL;
+        }
+
+        if (cnt == fill) {
+            fill++;
+        }
+        bin[cnt] = carry;
+    }
+    carry = NULL;
+
+    for (cnt = 0u; cnt < fill; cnt++) {
+
+        if (bin[cnt] != NULL) {
+            carry = dlsMerge(bin[cnt], carry, compare);
+        }
+    }
+    prev = sentinel;                                                            /* See note 3.                                              */
+
+    for (node = carry; node != NULL; node = node->next) {
+        node->prev = prev;
+        prev->next = node;
+        prev       = node;
+    }
+    prev->next     = sentinel;
+    sentinel->prev = prev;
+}
+
+/*================================*//** @cond *//*==  CONFIGURATION ERRORS  ==*/
+/** @endcond *//** @} *//******************************************************
+ * END of list.c
+ ******************************************************************************/
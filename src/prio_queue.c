@@ -115,52 +115,6 @@
 
 /*======================================================  LOCAL DATA TYPES  ==*/
 /*=============================================  LOCAL FUNCTION PROTOTYPES  ==*/
-
-/**@brief       Initialize bitmap
- * @param       pqbm
- *              Pointer to the bit map structure
- */
-static PORT_C_INLINE void bitmapInit(
-    struct esPqBitmap * bitmap);
-
-/**@brief       Set the bit corresponding to the priority argument
- * @param       pqbm
- *              Pointer to the bit map structure
- * @param       priority
- *              Priority which will be marked as used
- */
-static PORT_C_INLINE void bitmapSet(
-    struct esPqBitmap * bitmap,
-    uint_fast8_t        priority);
-
-/**@brief       Clear the bit corresponding to the priority argument
- * @param       pqbm
- *              Pointer to the bit map structure
- * @param       priority
- *              Priority which will be marked as unused
- */
-static PORT_C_INLINE void bitmapClear(
-    struct esPqBitmap * bitmap,
-    uint_fast8_t        priority);
-
-/**@brief       Get the highest priority set
- * @param       pqbm
- *              Pointer to the bit map structure
- * @return      The number of the highest priority marked as used
- */
-static PORT_C_INLINE uint_fast8_t bitmapGetHighest(
-    const struct esPqBitmap * bitmap);
-
-/**@brief       Is bit map empty?
- * @param       pqbm
- *              Pointer to the bit map structure
- * @return      The status of the bit map
- *  @retval     true - bit map is empty
- *  @retval     false - there is at least one bit set
- */
-static PORT_C_INLINE bool bitmapIsEmpty(
-    const struct esPqBitmap * bitmap);
-
 /*=======================================================  LOCAL VARIABLES  ==*/
 
 static const ES_MODULE_INFO_CREATE("Prio queue", "Priority ordered queue", "Nenad Radulovic");
@@ -168,109 +122,6 @@ static const ES_MODULE_INFO_CREATE("Prio queue", "Priority ordered queue", "Nena
 /*======================================================  GLOBAL VARIABLES  ==*/
 /*============================================  LOCAL FUNCTION DEFINITIONS  ==*/
 
-static PORT_C_INLINE void bitmapInit(
-    struct esPqBitmap * bitmap) {
-
-#if   (CONFIG_PQ_PRIORITY_LEVELS > ES_CPU_DEF_DATA_WIDTH)
-    uint_fast8_t        grp;
-
-    bitmap->bitGroup = 0u;
-    grp = ES_DIVISION_ROUNDUP(CONFIG_PQ_PRIORITY_LEVELS, ES_CPU_DEF_DATA_WIDTH);
-
-    while (grp != 0u) {
-        --grp;
-        bitmap->bit[grp] = 0u;
-    }
-#else
-    bitmap->bit[0] = 0u;
-#endif
-}
-
-static PORT_C_INLINE void bitmapSet(
-    struct esPqBitmap * bitmap,
-    uint_fast8_t        priority) {
-
-#if   (CONFIG_PQ_PRIORITY_LEVELS > ES_CPU_DEF_DATA_WIDTH)
-    uint_fast8_t        grpIndx;
-    uint_fast8_t        bitIndx;
-
-    bitIndx = priority &
-        (~((uint_fast8_t)0u) >> (sizeof(priority) * 8u - ES_UINT8_LOG2(ES_CPU_DEF_DATA_WIDTH)));
-    grpIndx               = priority >> ES_UINT8_LOG2(ES_CPU_DEF_DATA_WIDTH);
-    bitmap->bitGroup     |= ES_CPU_PWR2(grpIndx);
-    bitmap->bit[grpIndx] |= ES_CPU_PWR2(bitIndx);
-#else
-    bitmap->bit[0] |= ES_CPU_PWR2(priority);
-#endif
-}
-
-static PORT_C_INLINE void bitmapClear(
-    struct esPqBitmap * bitmap,
-    uint_fast8_t        priority) {
-
-#if   (CONFIG_PQ_PRIORITY_LEVELS > ES_CPU_DEF_DATA_WIDTH)
-    uint_fast8_t        grpIndx;
-    uint_fast8_t        bitIndx;
-
-    bitIndx = priority &
-        (~((uint_fast8_t)0u) >> (sizeof(priority) * 8u - ES_UINT8_LOG2(ES_CPU_DEF_DATA_WIDTH)));
-    grpIndx               = priority >> ES_UINT8_LOG2(ES_CPU_DEF_DATA_WIDTH);
-    bitmap->bit[grpIndx] &= ~ES_CPU_PWR2(bitIndx);
-
-    if (bitmap->bit[grpIndx] == 0u) {                                             /* Is this the last one bit cleared in this list?          */
-        bitmap->bitGroup &= ~ES_CPU_PWR2(grpIndx);                             /* Yes: then clear bit list indicator, too.                */
-    }
-#else
-    bitmap->bit[0] &= ~ES_CPU_PWR2(priority);
-#endif
-}
-
-static PORT_C_INLINE uint_fast8_t bitmapGetHighest(
-    const struct esPqBitmap * bitmap) {
-
-#if   (CONFIG_PQ_PRIORITY_LEVELS > ES_CPU_DEF_DATA_WIDTH)
-    uint_fast8_t        grpIndx;
-    uint_fast8_t        bitIndx;
-
-    grpIndx = ES_CPU_FLS(bitmap->bitGroup);
-    bitIndx = ES_CPU_FLS(bitmap->bit[grpIndx]);
-
-    return ((grpIndx << ES_UINT8_LOG2(ES_CPU_DEF_DATA_WIDTH)) | bitIndx);
-#else
-    uint_fast8_t        bitIndx;
-
-    bitIndx = ES_CPU_FLS(bitmap->bit[0]);
-
-    return (bitIndx);
-#endif
-}
-
-static PORT_C_INLINE bool bitmapIsEmpty(
-    const struct esPqBitmap * bitmap) {
-
-#if   (CONFIG_PQ_PRIORITY_LEVELS > ES_CPU_DEF_DATA_WIDTH)
-    bool              ret;
-
-    if (bitmap->bitGroup == 0u) {
-        ret = true;
-    } else {
-        ret = false;
-    }
-
-    return (ret);
-#else
-    bool              ret;
-
-    if (bitmap->bit[0] == 0u) {
-        ret = true;
-    } else {
-        ret = false;
-    }
-
-    return (ret);
-#endif
-}
-
 /*===================================  GLOBAL PRIVATE FUNCTION DEFINITIONS  ==*/
 /*====================================  GLOBAL PUBLIC FUNCTION DEFINITIONS  ==*/
 
@@ -282,7 +133,7 @@ void esPqInit(
     ES_REQUIRE(ES_API_POINTER, queue != NULL);
     ES_REQUIRE(ES_API_OBJECT,  queue->signature != PQ_SIGNATURE);
 
-    bitmapInit(&queue->bitmap);
+    esPqBitmapInit_(&queue->bitmap);
     cnt = CONFIG_PQ_PRIORITY_LEVELS;
 
     while (cnt != 0u) {
@@ -323,7 +174,7 @@ void esPqAdd(
 
     if (PQLIST_IS_EMPTY(sentinel)) {                                            /* Is PQ list empty?                                        */
         PQLIST_SENTINEL_INIT(sentinel, element);                                /* This element becomes first in the list.                  */
-        bitmapSet(&queue->bitmap, element->priority);                           /* Mark the priority list as used.                         */
+        esPqBitmapSet_(&queue->bitmap, element->priority);                      /* Mark the priority list as used.                          */
     } else {
         PQLIST_ENTRY_ADD_AFTER(sentinel->head, element);                        /* Element is added at the next of the list.                */
     }
@@ -343,7 +194,7 @@ void esPqRm(
 
     if (PQLIST_IS_ENTRY_SINGLE(element)) {
         PQLIST_SENTINEL_TERM(sentinel);                                         /* Make the list sentinel empty.                            */
-        bitmapClear(&element->queue->bitmap, element->priority);                /* Remove the mark since this list is not used.            */
+        esPqBitmapClear_(&element->queue->bitmap, element->priority);           /* Remove the mark since this list is not used.             */
     } else {
         if (PQLIST_IS_ENTRY_AT_HEAD(sentinel, element)) {                       /* In case we are removing first element in linked list then*/
             PQLIST_ROTATE_HEAD(sentinel);                                       /* advance the head to point to the next one in the list.   */
@@ -366,9 +217,9 @@ struct esPqElem * esPqGetHighest(
 
     ES_REQUIRE(ES_API_POINTER, queue != NULL);
     ES_REQUIRE(ES_API_OBJECT,  queue->signature == PQ_SIGNATURE);
-    ES_REQUIRE(ES_API_USAGE,   bitmapIsEmpty(&queue->bitmap) == false);
+    ES_REQUIRE(ES_API_USAGE,   esPqBitmapIsEmpty_(&queue->bitmap) == false);
 
-    prio = bitmapGetHighest(&queue->bitmap);
+    prio = esPqBitmapGetHighest_(&queue->bitmap);
     sentinel = &queue->list[prio];
 
     return (PQLIST_ENTRY_NEXT(sentinel));
@@ -382,7 +233,7 @@ struct esPqElem * esPqGetNext(
 
     ES_REQUIRE(ES_API_POINTER, queue != NULL);
     ES_REQUIRE(ES_API_OBJECT,  queue->signature == PQ_SIGNATURE);
-    ES_REQUIRE(ES_API_USAGE,   bitmapIsEmpty(&queue->bitmap) == false);
+    ES_REQUIRE(ES_API_USAGE,   esPqBitmapIsEmpty_(&queue->bitmap) == false);
     ES_REQUIRE(ES_API_RANGE,   priority < CONFIG_PQ_PRIORITY_LEVELS);
 
     sentinel = &queue->list[priority];
@@ -398,7 +249,7 @@ struct esPqElem * esPqRotate(
 
     ES_REQUIRE(ES_API_POINTER, queue != NULL);
     ES_REQUIRE(ES_API_OBJECT,  queue->signature == PQ_SIGNATURE);
-    ES_REQUIRE(ES_API_USAGE,   bitmapIsEmpty(&queue->bitmap) == false);
+    ES_REQUIRE(ES_API_USAGE,   esPqBitmapIsEmpty_(&queue->bitmap) == false);
     ES_REQUIRE(ES_API_RANGE,   prio < CONFIG_PQ_PRIORITY_LEVELS);
 
     sentinel = &queue->list[prio];
@@ -415,7 +266,7 @@ bool esPqIsEmpty(
     ES_REQUIRE(ES_API_POINTER, queue != NULL);
     ES_REQUIRE(ES_API_OBJECT,  queue->signature == PQ_SIGNATURE);
 
-    ret = bitmapIsEmpty(&queue->bitmap);
+    ret = esPqBitmapIsEmpty_(&queue->bitmap);
 
     return (ret);
 }
@@ -0,0 +1,266 @@
+/*
+ * This file is part of eSolid.
+ *
+ * Copyright (C) 2010 - 2013 Nenad Radulovic
+ *
+ * eSolid is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * eSolid is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with eSolid.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * web site:    http://github.com/nradulovic
+ * e-mail  :    nenad.b.radulovic@gmail.com
+ *//***********************************************************************//**
+ * @file
+ * @author      Nenad Radulovic
+ * @brief       Delay managed queue implementation
+ * @addtogroup  base_queue_codel
+ *********************************************************************//** @{ */
+/**@defgroup    base_queue_codel_impl Implementation
+ * @brief       Delay managed queue Implementation
+ * @{ *//*--------------------------------------------------------------------*/
+
+/*=========================================================  INCLUDE FILES  ==*/
+
+#include <stddef.h>
+
+#include "base/base.h"
+#include "base/queue_codel.h"
+
+/*=========================================================  LOCAL MACRO's  ==*/
+
+/**@brief       Delay managed queue signature
+ */
+#define QC_SIGNATURE                    ((esAtomic)0xdeedbef0ul)
+
+/**@brief       Is time @c a after or equal to time @c b?
+ */
+#define TIME_AFTER_EQ(a, b)                                                     \
+    ((int32_t)((uint32_t)(a) - (uint32_t)(b)) >= 0)
+
+/*======================================================  LOCAL DATA TYPES  ==*/
+/*=============================================  LOCAL FUNCTION PROTOTYPES  ==*/
+
+/**@brief       Calculate integer square root
+ * @param       value
+ *              Value
+ * @return      Largest integer whose square is not greater than @c value
+ */
+static uint32_t isqrt(
+    uint32_t            value);
+
+/**@brief       Calculate the time of the next drop
+ * @param       qc
+ *              Pointer to delay managed queue
+ * @param       time
+ *              Time of the previous drop
+ * @return      Time of the next drop: <code>time + interval / sqrt(count)
+ *              </code>
+ */
+static PORT_C_INLINE uint32_t controlLaw(
+    const struct esQpCodel * qc,
+    uint32_t            time);
+
+/**@brief       Update the state with sojourn time of dequeued item
+ * @param       qc
+ *              Pointer to delay managed queue
+ * @param       sojourn
+ *              Time the item has spent in queue
+ * @param       now
+ *              Current time
+ * @return      Has the delay been above target for at least an interval?
+ */
+static bool isOkToDrop(
+    struct esQpCodel *  qc,
+    uint32_t            sojourn,
+    uint32_t            now);
+
+/*=======================================================  LOCAL VARIABLES  ==*/
+
+static const ES_MODULE_INFO_CREATE("Queue CoDel", "Delay managed queue", "Nenad Radulovic");
+
+/*======================================================  GLOBAL VARIABLES  ==*/
+/*============================================  LOCAL FUNCTION DEFINITIONS  ==*/
+
+static uint32_t isqrt(
+    uint32_t            value) {
+
+    uint32_t            root;
+    uint32_t            bit;
+
+    root = 0u;
+    bit  = UINT32_C(1) << 30;
+
+    while (bit > value) {
+        bit >>= 2;
+    }
+
+    while (bit != 0u) {
+
+        if (value >= (root + bit)) {
+            value -= root + bit;
+            root   = (root >> 1) + bit;
+        } else {
+            root >>= 1;
+        }
+        bit >>= 2;
+    }
+
+    return (root);
+}
+
+static PORT_C_INLINE uint32_t controlLaw(
+    const struct esQpCodel * qc,
+    uint32_t            time) {
+
+    return (time + qc->interval / isqrt(qc->count));
+}
+
+/* 1)       An empty queue has no standing delay, regardless of how long the
+ *          last item has waited.
+ */
+static bool isOkToDrop(
+    struct esQpCodel *  qc,
+    uint32_t            sojourn,
+    uint32_t            now) {
+
+    if ((sojourn < qc->target) || esQpIsEmpty(&qc->qp)) {                      /* See note 1.                                              */
+        qc->isAbove = false;
+
+        return (false);
+    }
+
+    if (qc->isAbove == false) {
+        qc->isAbove        = true;
+        qc->firstAboveTime = now + qc->interval;
+
+        return (false);
+    }
+
+    return (TIME_AFTER_EQ(now, qc->firstAboveTime));
+}
+
+/*===================================  GLOBAL PRIVATE FUNCTION DEFINITIONS  ==*/
+/*====================================  GLOBAL PUBLIC FUNCTION DEFINITIONS  ==*/
+
+void esQpCodelInit(
+    struct esQpCodel *  qc,
+    void **             buff,
+    uint32_t *          stamp,
+    size_t              size,
+    uint32_t            target,
+    uint32_t            interval) {
+
+    ES_REQUIRE(ES_API_POINTER, qc != NULL);
+    ES_REQUIRE(ES_API_OBJECT,  qc->signature != QC_SIGNATURE);
+    ES_REQUIRE(ES_API_POINTER, buff != NULL);
+    ES_REQUIRE(ES_API_POINTER, stamp != NULL);
+    ES_REQUIRE(ES_API_RANGE,   size != 0u);
+    ES_REQUIRE(ES_API_RANGE,   interval != 0u);
+
+    esQpInit(
+        &qc->qp,
+        buff,
+        size);
+    qc->stamp          = stamp;
+    qc->target         = target;
+    qc->interval       = interval;
+    qc->firstAboveTime = 0u;
+    qc->dropNext       = 0u;
+    qc->count          = 0u;
+    qc->lastCount      = 0u;
+    qc->isAbove        = false;
+    qc->isDropping     = false;
+    ES_OBLIGATION(qc->signature = QC_SIGNATURE);
+}
+
+void esQpCodelTerm(
+    struct esQpCodel *  qc) {
+
+    ES_REQUIRE(ES_API_POINTER, qc != NULL);
+    ES_REQUIRE(ES_API_OBJECT,  qc->signature == QC_SIGNATURE);
+
+    esQpTerm(
+        &qc->qp);
+    qc->stamp = NULL;
+    ES_OBLIGATION(qc->signature = ~QC_SIGNATURE);
+}
+
+void esQpCodelPutItem(
+    struct esQpCodel *  qc,
+    void *              item,
+    uint32_t            now) {
+
+    ES_REQUIRE(ES_API_POINTER, qc != NULL);
+    ES_REQUIRE(ES_API_OBJECT,  qc->signature == QC_SIGNATURE);
+    ES_REQUIRE(ES_API_USAGE,   esQpIsFull(&qc->qp) == false);
+
+    qc->stamp[qc->qp.head] = now;                                               /* Timestamp the slot which will receive the item.          */
+    esQpPutItem(
+        &qc->qp,
+        item);
+}
+
+/* 1)       When a dropping state is re-entered shortly after the previous one
+ *          has ended, the drop rate continues close to where it was, since
+ *          the previous rate was obviously not enough to control the queue.
+ */
+void * esQpCodelGetItem(
+    struct esQpCodel *  qc,
+    uint32_t            now,
+    bool *              isDropped) {
+
+    void *              item;
+    uint32_t            sojourn;
+    uint32_t            delta;
+    bool                isOk;
+
+    ES_REQUIRE(ES_API_POINTER, qc != NULL);
+    ES_REQUIRE(ES_API_OBJECT,  qc->signature == QC_SIGNATURE);
+    ES_REQUIRE(ES_API_POINTER, isDropped != NULL);
+    ES_REQUIRE(ES_API_USAGE,   esQpIsEmpty(&qc->qp) == false);
+
+    sojourn    = now - qc->stamp[qc->qp.tail];
+    item       = esQpGetItem(&qc->qp);
+    isOk       = isOkToDrop(qc, sojourn, now);
+    *isDropped = false;
+
+    if (qc->isDropping == true) {
+
+        if (isOk == false) {                                                    /* Delay is below target: leave dropping state.             */
+            qc->isDropping = false;
+        } else if (TIME_AFTER_EQ(now, qc->dropNext)) {
+            *isDropped   = true;
+            qc->count++;
+            qc->dropNext = controlLaw(qc, qc->dropNext);
+        }
+    } else if (isOk == true) {                                                  /* Delay was above target for an interval: start dropping.  */
+        *isDropped     = true;
+        qc->isDropping = true;
+        delta          = qc->count - qc->lastCount;
+
+        if ((delta > 1u) &&
+            ((uint32_t)(now - qc->dropNext) < (16u * qc->interval))) {          /* See note 1.                                              */
+            qc->count = delta;
+        } else {
+            qc->count = 1u;
+        }
+        qc->dropNext  = controlLaw(qc, now);
+        qc->lastCount = qc->count;
+    }
+
+    return (item);
+}
+
+/*================================*//** @cond *//*==  CONFIGURATION ERRORS  ==*/
+/** @endcond *//** @} *//** @} *//*********************************************
+ * END of queue_codel.c
+ ******************************************************************************/
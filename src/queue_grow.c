@@ -0,0 +1,153 @@
+/*
+ * This file is part of eSolid.
+ *
+ * Copyright (C) 2010 - 2013 Nenad Radulovic
+ *
+ * eSolid is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * eSolid is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with eSolid.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * web site:    http://github.com/nradulovic
+ * e-mail  :    nenad.b.radulovic@gmail.com
+ *//***********************************************************************//**
+ * @file
+ * @author      Nenad Radulovic
+ * @brief       Growable pointer queue implementation
+ * @addtogroup  base_queue_grow
+ *********************************************************************//** @{ */
+/**@defgroup    base_queue_grow_impl Implementation
+ * @brief       Growable pointer queue Implementation
+ * @{ *//*--------------------------------------------------------------------*/
+
+/*=========================================================  INCLUDE FILES  ==*/
+
+#include <stddef.h>
+
+#include "base/base.h"
+#include "base/queue_grow.h"
+
+/*=========================================================  LOCAL MACRO's  ==*/
+
+/**@brief       Growable queue signature
+ */
+#define QPGROW_SIGNATURE                ((esAtomic)0xdeedbef4ul)
+
+/*======================================================  LOCAL DATA TYPES  ==*/
+/*=============================================  LOCAL FUNCTION PROTOTYPES  ==*/
+/*=======================================================  LOCAL VARIABLES  ==*/
+
+static const ES_MODULE_INFO_CREATE("Queue grow", "Growable pointer queue", "Nenad Radulovic");
+
+/*======================================================  GLOBAL VARIABLES  ==*/
+/*============================================  LOCAL FUNCTION DEFINITIONS  ==*/
+/*===================================  GLOBAL PRIVATE FUNCTION DEFINITIONS  ==*/
+
+/* 1)       Items are copied in two runs, from tail to the end of old buffer
+ *          and from the beginning of old buffer to head, so after the copy the
+ *          queue is not wrapped. The counter of dropped items is kept.
+ */
+esError esQpGrowResize_(
+    struct esQpGrow *   qg,
+    uint32_t            size) {
+
+    void **             buff;
+    void **             old;
+    uint32_t            occupied;
+    uint32_t            cnt;
+    uint32_t            pos;
+
+    ES_REQUIRE(ES_API_POINTER, qg != NULL);
+    ES_REQUIRE(ES_API_OBJECT,  qg->signature == QPGROW_SIGNATURE);
+    ES_REQUIRE(ES_API_RANGE,   size >= (qg->qp.size - qg->qp.free));
+
+    buff = esAllocatorAlloc(qg->allocator, ES_QP_SIZEOF(size));
+
+    if (buff == NULL) {
+
+        return (ES_ERROR_NO_MEMORY);
+    }
+    old      = qg->qp.buff;
+    occupied = qg->qp.size - qg->qp.free;
+    pos      = qg->qp.tail;
+
+    for (cnt = 0u; cnt < occupied; cnt++) {                                     /* See note 1.                                              */
+        buff[cnt] = old[pos++];
+
+        if (pos == qg->qp.size) {
+            pos = 0u;
+        }
+    }
+    esAllocatorFree(qg->allocator, old, ES_QP_SIZEOF(qg->qp.size));
+    qg->qp.buff = buff;
+    qg->qp.head = (occupied == size) ? 0u : occupied;
+    qg->qp.tail = 0u;
+    qg->qp.free = size - occupied;
+    qg->qp.size = size;
+
+    return (ES_ERROR_NONE);
+}
+
+/*====================================  GLOBAL PUBLIC FUNCTION DEFINITIONS  ==*/
+
+esError esQpGrowInit(
+    struct esQpGrow *   qg,
+    const struct esAllocator * allocator,
+    size_t              minSize,
+    size_t              maxSize,
+    uint32_t            shrinkAfter) {
+
+    void **             buff;
+
+    ES_REQUIRE(ES_API_POINTER, qg != NULL);
+    ES_REQUIRE(ES_API_OBJECT,  qg->signature != QPGROW_SIGNATURE);
+    ES_REQUIRE(ES_API_POINTER, allocator != NULL);
+    ES_REQUIRE(ES_API_RANGE,   minSize != 0u);
+    ES_REQUIRE(ES_API_RANGE,   minSize <= maxSize);
+    ES_REQUIRE(ES_API_RANGE,   maxSize <= UINT32_MAX);
+
+    buff = esAllocatorAlloc(allocator, ES_QP_SIZEOF(minSize));
+
+    if (buff == NULL) {
+
+        return (ES_ERROR_NO_MEMORY);
+    }
+    esQpInit(
+        &qg->qp,
+        buff,
+        minSize);
+    qg->allocator   = allocator;
+    qg->minSize     = (uint32_t)minSize;
+    qg->maxSize     = (uint32_t)maxSize;
+    qg->shrinkAfter = shrinkAfter;
+    qg->lowCount    = 0u;
+    ES_OBLIGATION(qg->signature = QPGROW_SIGNATURE);
+
+    return (ES_ERROR_NONE);
+}
+
+void esQpGrowTerm(
+    struct esQpGrow *   qg) {
+
+    ES_REQUIRE(ES_API_POINTER, qg != NULL);
+    ES_REQUIRE(ES_API_OBJECT,  qg->signature == QPGROW_SIGNATURE);
+
+    esAllocatorFree(qg->allocator, esQpBuff(&qg->qp), ES_QP_SIZEOF(qg->qp.size));
+    esQpTerm(
+        &qg->qp);
+    qg->allocator = NULL;
+    ES_OBLIGATION(qg->signature = ~QPGROW_SIGNATURE);
+}
+
+/*================================*//** @cond *//*==  CONFIGURATION ERRORS  ==*/
+/** @endcond *//** @} *//** @} *//*********************************************
+ * END of queue_grow.c
+ ******************************************************************************/
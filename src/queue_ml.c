@@ -0,0 +1,178 @@
+/*
+ * This file is part of eSolid.
+ *
+ * Copyright (C) 2010 - 2013 Nenad Radulovic
+ *
+ * eSolid is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * eSolid is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with eSolid.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * web site:    http://github.com/nradulovic
+ * e-mail  :    nenad.b.radulovic@gmail.com
+ *//***********************************************************************//**
+ * @file
+ * @author      Nenad Radulovic
+ * @brief       Multi-level pointer queue implementation
+ * @addtogroup  base_queue_ml
+ *********************************************************************//** @{ */
+/**@defgroup    base_queue_ml_impl Implementation
+ * @brief       Multi-level pointer queue Implementation
+ * @{ *//*--------------------------------------------------------------------*/
+
+/*=========================================================  INCLUDE FILES  ==*/
+
+#include <stddef.h>
+
+#include "base/base.h"
+#include "base/queue_ml.h"
+
+/*=========================================================  LOCAL MACRO's  ==*/
+
+/**@brief       Multi-level queue signature
+ */
+#define QPML_SIGNATURE                  ((esAtomic)0xdeedbef3ul)
+
+/*======================================================  LOCAL DATA TYPES  ==*/
+/*=============================================  LOCAL FUNCTION PROTOTYPES  ==*/
+/*=======================================================  LOCAL VARIABLES  ==*/
+
+static const ES_MODULE_INFO_CREATE("Queue ML", "Multi-level pointer queue", "Nenad Radulovic");
+
+/*======================================================  GLOBAL VARIABLES  ==*/
+/*============================================  LOCAL FUNCTION DEFINITIONS  ==*/
+/*===================================  GLOBAL PRIVATE FUNCTION DEFINITIONS  ==*/
+/*====================================  GLOBAL PUBLIC FUNCTION DEFINITIONS  ==*/
+
+void esQpMlInit(
+    struct esQpMl *     ml,
+    void **             buff,
+    size_t              size) {
+
+    uint_fast8_t        cnt;
+
+    ES_REQUIRE(ES_API_POINTER, ml != NULL);
+    ES_REQUIRE(ES_API_OBJECT,  ml->signature != QPML_SIGNATURE);
+    ES_REQUIRE(ES_API_POINTER, buff != NULL);
+    ES_REQUIRE(ES_API_RANGE,   size != 0u);
+
+    esPqBitmapInit_(&ml->bitmap);
+    cnt = CONFIG_PQ_PRIORITY_LEVELS;
+
+    while (cnt != 0u) {
+        --cnt;
+        esQpInit(
+            &ml->level[cnt],
+            &buff[cnt * size],
+            size);
+    }
+    ES_OBLIGATION(ml->signature = QPML_SIGNATURE);
+}
+
+void esQpMlTerm(
+    struct esQpMl *     ml) {
+
+    uint_fast8_t        cnt;
+
+    ES_REQUIRE(ES_API_POINTER, ml != NULL);
+    ES_REQUIRE(ES_API_OBJECT,  ml->signature == QPML_SIGNATURE);
+
+    esPqBitmapInit_(&ml->bitmap);
+    cnt = CONFIG_PQ_PRIORITY_LEVELS;
+
+    while (cnt != 0u) {
+        --cnt;
+        esQpTerm(
+            &ml->level[cnt]);
+    }
+    ES_OBLIGATION(ml->signature = ~QPML_SIGNATURE);
+}
+
+void esQpMlPutItem(
+    struct esQpMl *     ml,
+    void *              item,
+    uint_fast8_t        priority) {
+
+    struct esQp *       qp;
+
+    ES_REQUIRE(ES_API_POINTER, ml != NULL);
+    ES_REQUIRE(ES_API_OBJECT,  ml->signature == QPML_SIGNATURE);
+    ES_REQUIRE(ES_API_RANGE,   priority < CONFIG_PQ_PRIORITY_LEVELS);
+
+    qp = &ml->level[priority];
+
+    if (esQpIsEmpty(qp) == true) {                                              /* Is this empty to non-empty transition?                   */
+        esPqBitmapSet_(&ml->bitmap, priority);
+    }
+    esQpPutItem(
+        qp,
+        item);
+}
+
+void * esQpMlGetHighest(
+    struct esQpMl *     ml,
+    uint_fast8_t *      priority) {
+
+    struct esQp *       qp;
+    uint_fast8_t        prio;
+    void *              item;
+
+    ES_REQUIRE(ES_API_POINTER, ml != NULL);
+    ES_REQUIRE(ES_API_OBJECT,  ml->signature == QPML_SIGNATURE);
+    ES_REQUIRE(ES_API_USAGE,   esPqBitmapIsEmpty_(&ml->bitmap) == false);
+
+    prio = esPqBitmapGetHighest_(&ml->bitmap);
+    qp   = &ml->level[prio];
+    item = esQpGetItem(qp);
+
+    if (esQpIsEmpty(qp) == true) {                                              /* Is this non-empty to empty transition?                   */
+        esPqBitmapClear_(&ml->bitmap, prio);
+    }
+
+    if (priority != NULL) {
+        *priority = prio;
+    }
+
+    return (item);
+}
+
+bool esQpMlIsFull(
+    const struct esQpMl * ml,
+    uint_fast8_t        priority) {
+
+    bool                ret;
+
+    ES_REQUIRE(ES_API_POINTER, ml != NULL);
+    ES_REQUIRE(ES_API_OBJECT,  ml->signature == QPML_SIGNATURE);
+    ES_REQUIRE(ES_API_RANGE,   priority < CONFIG_PQ_PRIORITY_LEVELS);
+
+    ret = esQpIsFull(&ml->level[priority]);
+
+    return (ret);
+}
+
+bool esQpMlIsEmpty(
+    const struct esQpMl * ml) {
+
+    bool                ret;
+
+    ES_REQUIRE(ES_API_POINTER, ml != NULL);
+    ES_REQUIRE(ES_API_OBJECT,  ml->signature == QPML_SIGNATURE);
+
+    ret = esPqBitmapIsEmpty_(&ml->bitmap);
+
+    return (ret);
+}
+
+/*================================*//** @cond *//*==  CONFIGURATION ERRORS  ==*/
+/** @endcond *//** @} *//** @} *//*********************************************
+ * END of queue_ml.c
+ ******************************************************************************/
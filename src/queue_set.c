@@ -0,0 +1,196 @@
+/*
+ * This file is part of eSolid.
+ *
+ * Copyright (C) 2010 - 2013 Nenad Radulovic
+ *
+ * eSolid is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * eSolid is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with eSolid.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * web site:    http://github.com/nradulovic
+ * e-mail  :    nenad.b.radulovic@gmail.com
+ *//***********************************************************************//**
+ * @file
+ * @author      Nenad Radulovic
+ * @brief       Pointer queue set implementation
+ * @addtogroup  base_queue_set
+ *********************************************************************//** @{ */
+/**@defgroup    base_queue_set_impl Implementation
+ * @brief       Pointer queue set Implementation
+ * @{ *//*--------------------------------------------------------------------*/
+
+/*=========================================================  INCLUDE FILES  ==*/
+
+#include <stddef.h>
+
+#include "base/base.h"
+#include "base/queue_set.h"
+
+/*=========================================================  LOCAL MACRO's  ==*/
+
+/**@brief       Queue set signature
+ */
+#define QPSET_SIGNATURE                 ((esAtomic)0xdeedbef1ul)
+
+/*======================================================  LOCAL DATA TYPES  ==*/
+/*=============================================  LOCAL FUNCTION PROTOTYPES  ==*/
+/*=======================================================  LOCAL VARIABLES  ==*/
+
+static const ES_MODULE_INFO_CREATE("Queue set", "Pointer queue set", "Nenad Radulovic");
+
+/*======================================================  GLOBAL VARIABLES  ==*/
+/*============================================  LOCAL FUNCTION DEFINITIONS  ==*/
+/*===================================  GLOBAL PRIVATE FUNCTION DEFINITIONS  ==*/
+/*====================================  GLOBAL PUBLIC FUNCTION DEFINITIONS  ==*/
+
+void esQpSetInit(
+    struct esQpSet *    set) {
+
+    uint_fast8_t        cnt;
+
+    ES_REQUIRE(ES_API_POINTER, set != NULL);
+    ES_REQUIRE(ES_API_OBJECT,  set->signature != QPSET_SIGNATURE);
+
+    esPqBitmapInit_(&set->bitmap);
+    cnt = CONFIG_PQ_PRIORITY_LEVELS;
+
+    while (cnt != 0u) {
+        --cnt;
+        set->queue[cnt] = NULL;
+    }
+    ES_OBLIGATION(set->signature = QPSET_SIGNATURE);
+}
+
+void esQpSetTerm(
+    struct esQpSet *    set) {
+
+    ES_REQUIRE(ES_API_POINTER, set != NULL);
+    ES_REQUIRE(ES_API_OBJECT,  set->signature == QPSET_SIGNATURE);
+
+#if (CONFIG_API_VALIDATION == 0)
+    (void)set;
+#endif
+    ES_OBLIGATION(set->signature = ~QPSET_SIGNATURE);
+}
+
+void esQpSetAttach(
+    struct esQpSet *    set,
+    struct esQp *       qp,
+    uint_fast8_t        priority) {
+
+    ES_REQUIRE(ES_API_POINTER, set != NULL);
+    ES_REQUIRE(ES_API_OBJECT,  set->signature == QPSET_SIGNATURE);
+    ES_REQUIRE(ES_API_POINTER, qp != NULL);
+    ES_REQUIRE(ES_API_RANGE,   priority < CONFIG_PQ_PRIORITY_LEVELS);
+    ES_REQUIRE(ES_API_USAGE,   set->queue[priority] == NULL);
+
+    set->queue[priority] = qp;
+
+    if (esQpIsEmpty(qp) == false) {
+        esPqBitmapSet_(&set->bitmap, priority);
+    }
+}
+
+void esQpSetDetach(
+    struct esQpSet *    set,
+    uint_fast8_t        priority) {
+
+    ES_REQUIRE(ES_API_POINTER, set != NULL);
+    ES_REQUIRE(ES_API_OBJECT,  set->signature == QPSET_SIGNATURE);
+    ES_REQUIRE(ES_API_RANGE,   priority < CONFIG_PQ_PRIORITY_LEVELS);
+    ES_REQUIRE(ES_API_USAGE,   set->queue[priority] != NULL);
+
+    esPqBitmapClear_(&set->bitmap, priority);
+    set->queue[priority] = NULL;
+}
+
+void esQpSetPutItem(
+    struct esQpSet *    set,
+    uint_fast8_t        priority,
+    void *              item) {
+
+    struct esQp *       qp;
+
+    ES_REQUIRE(ES_API_POINTER, set != NULL);
+    ES_REQUIRE(ES_API_OBJECT,  set->signature == QPSET_SIGNATURE);
+    ES_REQUIRE(ES_API_RANGE,   priority < CONFIG_PQ_PRIORITY_LEVELS);
+    ES_REQUIRE(ES_API_USAGE,   set->queue[priority] != NULL);
+
+    qp = set->queue[priority];
+
+    if (esQpIsEmpty(qp) == true) {                                              /* Is this empty to non-empty transition?                   */
+        esPqBitmapSet_(&set->bitmap, priority);
+    }
+    esQpPutItem(
+        qp,
+        item);
+}
+
+void * esQpSetGetItem(
+    struct esQpSet *    set,
+    uint_fast8_t        priority) {
+
+    struct esQp *       qp;
+    void *              item;
+
+    ES_REQUIRE(ES_API_POINTER, set != NULL);
+    ES_REQUIRE(ES_API_OBJECT,  set->signature == QPSET_SIGNATURE);
+    ES_REQUIRE(ES_API_RANGE,   priority < CONFIG_PQ_PRIORITY_LEVELS);
+    ES_REQUIRE(ES_API_USAGE,   set->queue[priority] != NULL);
+
+    qp   = set->queue[priority];
+    item = esQpGetItem(qp);
+
+    if (esQpIsEmpty(qp) == true) {                                              /* Is this non-empty to empty transition?                   */
+        esPqBitmapClear_(&set->bitmap, priority);
+    }
+
+    return (item);
+}
+
+struct esQp * esQpSetGetHighest(
+    const struct esQpSet * set,
+    uint_fast8_t *      priority) {
+
+    uint_fast8_t        prio;
+
+    ES_REQUIRE(ES_API_POINTER, set != NULL);
+    ES_REQUIRE(ES_API_OBJECT,  set->signature == QPSET_SIGNATURE);
+    ES_REQUIRE(ES_API_POINTER, priority != NULL);
+
+    if (esPqBitmapIsEmpty_(&set->bitmap) == true) {
+
+        return (NULL);
+    }
+    prio      = esPqBitmapGetHighest_(&set->bitmap);
+    *priority = prio;
+
+    return (set->queue[prio]);
+}
+
+bool esQpSetIsEmpty(
+    const struct esQpSet * set) {
+
+    bool                ret;
+
+    ES_REQUIRE(ES_API_POINTER, set != NULL);
+    ES_REQUIRE(ES_API_OBJECT,  set->signature == QPSET_SIGNATURE);
+
+    ret = esPqBitmapIsEmpty_(&set->bitmap);
+
+    return (ret);
+}
+
+/*================================*//** @cond *//*==  CONFIGURATION ERRORS  ==*/
+/** @endcond *//** @} *//** @} *//*********************************************
+ * END of queue_set.c
+ ******************************************************************************/
@@ -0,0 +1,499 @@
+/*
+ * This file is part of eSolid.
+ *
+ * Copyright (C) 2010 - 2013 Nenad Radulovic
+ *
+ * eSolid is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * eSolid is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with eSolid.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * web site:    http://github.com/nradulovic
+ * e-mail  :    nenad.b.radulovic@gmail.com
+ *//***********************************************************************//**
+ * @file
+ * @author      Nenad Radulovic
+ * @brief       Red-black tree implementation
+ * @addtogroup  base_rbtree
+ *********************************************************************//** @{ */
+/**@defgroup    base_rbtree_impl Implementation
+ * @brief       Red-black tree Implementation
+ * @{ *//*--------------------------------------------------------------------*/
+
+/*=========================================================  INCLUDE FILES  ==*/
+
+#include <stddef.h>
+
+#include "base/base.h"
+#include "base/rbtree.h"
+
+/*=========================================================  LOCAL MACRO's  ==*/
+
+/**@brief       Red-black tree signature
+ */
+#define RBT_SIGNATURE                   ((esAtomic)0xdeedbef5ul)
+
+#define RBT_RED                         0u
+
+#define RBT_BLACK                       1u
+
+/**@brief       Is the node black? Missing (NULL) leaves are black.
+ */
+#define RBT_IS_BLACK(node)                                                      \
+    (((node) == NULL) || ((node)->color == RBT_BLACK))
+
+/*======================================================  LOCAL DATA TYPES  ==*/
+/*=============================================  LOCAL FUNCTION PROTOTYPES  ==*/
+
+/**@brief       Replace a child of @c parent, or the root when @c parent is NULL
+ */
+static void changeChild(
+    struct esRbt *      tree,
+    struct esRbtNode *  parent,
+    struct esRbtNode *  oldNode,
+    struct esRbtNode *  newNode);
+
+static void rotateLeft(
+    struct esRbt *      tree,
+    struct esRbtNode *  node);
+
+static void rotateRight(
+    struct esRbt *      tree,
+    struct esRbtNode *  node);
+
+/**@brief       Restore tree properties after insert
+ */
+static void insertFixup(
+    struct esRbt *      tree,
+    struct esRbtNode *  node);
+
+/**@brief       Restore tree properties after a black node was removed
+ * @param       tree
+ *              Pointer to red-black tree
+ * @param       node
+ *              Node which took the place of removed node, may be NULL
+ * @param       parent
+ *              Parent of @c node
+ */
+static void removeFixup(
+    struct esRbt *      tree,
+    struct esRbtNode *  node,
+    struct esRbtNode *  parent);
+
+/*=======================================================  LOCAL VARIABLES  ==*/
+
+static const ES_MODULE_INFO_CREATE("RB tree", "Red-black tree", "Nenad Radulovic");
+
+/*======================================================  GLOBAL VARIABLES  ==*/
+/*============================================  LOCAL FUNCTION DEFINITIONS  ==*/
+
+static void changeChild(
+    struct esRbt *      tree,
+    struct esRbtNode *  parent,
+    struct esRbtNode *  oldNode,
+    struct esRbtNode *  newNode) {
+
+    if (parent == NULL) {
+        tree->root = newNode;
+    } else if (parent->left == oldNode) {
+        parent->left = newNode;
+    } else {
+        parent->right = newNode;
+    }
+}
+
+static void rotateLeft(
+    struct esRbt *      tree,
+    struct esRbtNode *  node) {
+
+    struct esRbtNode *  pivot;
+
+    pivot       = node->right;
+    node->right = pivot->left;
+
+    if (pivot->left != NULL) {
+        pivot->left->parent = node;
+    }
+    pivot->parent = node->parent;
+    changeChild(tree, node->parent, node, pivot);
+    pivot->left   = node;
+    node->parent  = pivot;
+}
+
+static void rotateRight(
+    struct esRbt *      tree,
+    struct esRbtNode *  node) {
+
+    struct esRbtNode *  pivot;
+
+    pivot      = node->left;
+    node->left = pivot->right;
+
+    if (pivot->right != NULL) {
+        pivot->right->parent = node;
+    }
+    pivot->parent = node->parent;
+    changeChild(tree, node->parent, node, pivot);
+    pivot->right  = node;
+    node->parent  = pivot;
+}
+
+/* 1)       The parent is red, so it is not the root and grandparent exists.
+ */
+static void insertFixup(
+    struct esRbt *      tree,
+    struct esRbtNode *  node) {
+
+    struct esRbtNode *  parent;
+    struct esRbtNode *  grand;
+    struct esRbtNode *  uncle;
+
+    while (((parent = node->parent) != NULL) && (parent->color == RBT_RED)) {
+        grand = parent->parent;                                                 /* See note 1.                                              */
+
+        if (parent == grand->left) {
+            uncle = grand->right;
+
+            if (RBT_IS_BLACK(uncle) == false) {                                 /* Red uncle: recolor and move up                           */
+                parent->color = RBT_BLACK;
+                uncle->color  = RBT_BLACK;
+                grand->color  = RBT_RED;
+                node          = grand;
+            } else {
+
+                if (node == parent->right) {
+                    rotateLeft(tree, parent);
+                    node   = parent;
+                    parent = node->parent;
+                }
+                parent->color = RBT_BLACK;
+                grand->color  = RBT_RED;
+                rotateRight(tree, grand);
+            }
+        } else {
+            uncle = grand->left;
+
+            if (RBT_IS_BLACK(uncle) == false) {
+                parent->color = RBT_BLACK;
+                uncle->color  = RBT_BLACK;
+                grand->color  = RBT_RED;
+                node          = grand;
+            } else {
+
+                if (node == parent->left) {
+                    rotateRight(tree, parent);
+                    node   = parent;
+                    parent = node->parent;
+                }
+                parent->color = RBT_BLACK;
+                grand->color  = RBT_RED;
+                rotateLeft(tree, grand);
+            }
+        }
+    }
+    tree->root->color = RBT_BLACK;
+}
+
+/* 1)       The removed black node left its place one black node short, so the
+ *          sibling subtree contains at least one black node and the sibling
+ *          exists.
+ */
+static void removeFixup(
+    struct esRbt *      tree,
+    struct esRbtNode *  node,
+    struct esRbtNode *  parent) {
+
+    struct esRbtNode *  sibling;
+
+    while ((node != tree->root) && (RBT_IS_BLACK(node) == true)) {
+
+        if (node == parent->left) {
+            sibling = parent->right;                                            /* See note 1.                                              */
+
+            if (sibling->color == RBT_RED) {
+                sibling->color = RBT_BLACK;
+                parent->color  = RBT_RED;
+                rotateLeft(tree, parent);
+                sibling        = parent->right;
+            }
+
+            if ((RBT_IS_BLACK(sibling->left) == true) && (RBT_IS_BLACK(sibling->right) == true)) {
+                sibling->color = RBT_RED;
+                node           = parent;
+                parent         = node->parent;
+            } else {
+
+                if (RBT_IS_BLACK(sibling->right) == true) {
+                    sibling->left->color = RBT_BLACK;
+                    sibling->color       = RBT_RED;
+                    rotateRight(tree, sibling);
+                    sibling              = parent->right;
+                }
+                sibling->color        = parent->color;
+                parent->color         = RBT_BLACK;
+                sibling->right->color = RBT_BLACK;
+                rotateLeft(tree, parent);
+                node                  = tree->root;
+            }
+        } else {
+            sibling = parent->left;
+
+            if (sibling->color == RBT_RED) {
+                sibling->color = RBT_BLACK;
+                parent->color  = RBT_RED;
+                rotateRight(tree, parent);
+                sibling        = parent->left;
+            }
+
+            if ((RBT_IS_BLACK(sibling->left) == true) && (RBT_IS_BLACK(sibling->right) == true)) {
+                sibling->color = RBT_RED;
+                node           = parent;
+                parent         = node->parent;
+            } else {
+
+                if (RBT_IS_BLACK(sibling->left) == true) {
+                    sibling->right->color = RBT_BLACK;
+                    sibling->color        = RBT_RED;
+                    rotateLeft(tree, sibling);
+                    sibling               = parent->left;
+                }
+                sibling->color       = parent->color;
+                parent->color        = RBT_BLACK;
+                sibling->left->color = RBT_BLACK;
+                rotateRight(tree, parent);
+                node                 = tree->root;
+            }
+        }
+    }
+
+    if (node != NULL) {
+        node->color = RBT_BLACK;
+    }
+}
+
+/*===================================  GLOBAL PRIVATE FUNCTION DEFINITIONS  ==*/
+/*====================================  GLOBAL PUBLIC FUNCTION DEFINITIONS  ==*/
+
+void esRbtInit(
+    struct esRbt *      tree,
+    esRbtCompare        compare) {
+
+    ES_REQUIRE(ES_API_POINTER, tree != NULL);
+    ES_REQUIRE(ES_API_OBJECT,  tree->signature != RBT_SIGNATURE);
+    ES_REQUIRE(ES_API_POINTER, compare != NULL);
+
+    tree->root     = NULL;
+    tree->leftmost = NULL;
+    tree->compare  = compare;
+    ES_OBLIGATION(tree->signature = RBT_SIGNATURE);
+}
+
+void esRbtTerm(
+    struct esRbt *      tree) {
+
+    ES_REQUIRE(ES_API_POINTER, tree != NULL);
+    ES_REQUIRE(ES_API_OBJECT,  tree->signature == RBT_SIGNATURE);
+
+    tree->root     = NULL;
+    tree->leftmost = NULL;
+    tree->compare  = NULL;
+    ES_OBLIGATION(tree->signature = ~RBT_SIGNATURE);
+}
+
+/* 1)       The new node is the leftmost node only when the search never turned
+ *          right.
+ */
+void esRbtInsert(
+    struct esRbt *      tree,
+    struct esRbtNode *  node) {
+
+    struct esRbtNode ** link;
+    struct esRbtNode *  parent;
+    bool                isLeftmost;
+
+    ES_REQUIRE(ES_API_POINTER, tree != NULL);
+    ES_REQUIRE(ES_API_OBJECT,  tree->signature == RBT_SIGNATURE);
+    ES_REQUIRE(ES_API_POINTER, node != NULL);
+
+    link       = &tree->root;
+    parent     = NULL;
+    isLeftmost = true;
+
+    while (*link != NULL) {
+        parent = *link;
+
+        if (tree->compare(node, parent) < 0) {
+            link = &parent->left;
+        } else {
+            link       = &parent->right;
+            isLeftmost = false;                                                 /* See note 1.                                              */
+        }
+    }
+    node->parent = parent;
+    node->left   = NULL;
+    node->right  = NULL;
+    node->color  = RBT_RED;
+    *link        = node;
+
+    if (isLeftmost == true) {
+        tree->leftmost = node;
+    }
+    insertFixup(tree, node);
+}
+
+/* 1)       A node with two children is replaced by its successor, which has no
+ *          left child. The successor takes the color of removed node, so the
+ *          tree loses a black node only when the successor was black.
+ */
+void esRbtRemove(
+    struct esRbt *      tree,
+    struct esRbtNode *  node) {
+
+    struct esRbtNode *  child;
+    struct esRbtNode *  parent;
+    struct esRbtNode *  successor;
+    uint_fast8_t        color;
+
+    ES_REQUIRE(ES_API_POINTER, tree != NULL);
+    ES_REQUIRE(ES_API_OBJECT,  tree->signature == RBT_SIGNATURE);
+    ES_REQUIRE(ES_API_POINTER, node != NULL);
+
+    if (tree->leftmost == node) {
+        tree->leftmost = esRbtNext(node);
+    }
+
+    if (node->left == NULL) {
+        child  = node->right;
+        parent = node->parent;
+        color  = node->color;
+        changeChild(tree, parent, node, child);
+
+        if (child != NULL) {
+            child->parent = parent;
+        }
+    } else if (node->right == NULL) {
+        child  = node->left;
+        parent = node->parent;
+        color  = node->color;
+        changeChild(tree, parent, node, child);
+        child->parent = parent;
+    } else {                                                                    /* See note 1.                                              */
+        successor = node->right;
+
+        while (successor->left != NULL) {
+            successor = successor->left;
+        }
+        color = successor->color;
+        child = successor->right;
+
+        if (successor->parent == node) {
+            parent = successor;
+        } else {
+            parent       = successor->parent;
+            parent->left = child;
+
+            if (child != NULL) {
+                child->parent = parent;
+            }
+            successor->right         = node->right;
+            successor->right->parent = successor;
+        }
+        changeChild(tree, node->parent, node, successor);
+        successor->parent       = node->parent;
+        successor->left         = node->left;
+        successor->left->parent = successor;
+        successor->color        = node->color;
+    }
+
+    if (color == RBT_BLACK) {
+        removeFixup(tree, child, parent);
+    }
+}
+
+struct esRbtNode * esRbtLowerBound(
+    const struct esRbt * tree,
+    const struct esRbtNode * key) {
+
+    struct esRbtNode *  current;
+    struct esRbtNode *  found;
+
+    ES_REQUIRE(ES_API_POINTER, tree != NULL);
+    ES_REQUIRE(ES_API_OBJECT,  tree->signature == RBT_SIGNATURE);
+    ES_REQUIRE(ES_API_POINTER, key != NULL);
+
+    current = tree->root;
+    found   = NULL;
+
+    while (current != NULL) {
+
+        if (tree->compare(current, key) < 0) {
+            current = current->right;
+        } else {
+            found   = current;
+            current = current->left;
+        }
+    }
+
+    return (found);
+}
+
+struct esRbtNode * esRbtNext(
+    const struct esRbtNode * node) {
+
+    const struct esRbtNode * parent;
+
+    ES_REQUIRE(ES_API_POINTER, node != NULL);
+
+    if (node->right != NULL) {
+        node = node->right;
+
+        while (node->left != NULL) {
+            node = node->left;
+        }
+
+        return ((struct esRbtNode *)node);
+    }
+
+    while (((parent = node->parent) != NULL) && (node == parent->right)) {
+        node = parent;
+    }
+
+    return ((struct esRbtNode *)parent);
+}
+
+struct esRbtNode * esRbtPrev(
+    const struct esRbtNode * node) {
+
+    const struct esRbtNode * parent;
+
+    ES_REQUIRE(ES_API_POINTER, node != NULL);
+
+    if (node->left != NULL) {
+        node = node->left;
+
+        while (node->right != NULL) {
+            node = node->right;
+        }
+
+        return ((struct esRbtNode *)node);
+    }
+
+    while (((parent = node->parent) != NULL) && (node == parent->left)) {
+        node = parent;
+    }
+
+    return ((struct esRbtNode *)parent);
+}
+
+/*================================*//** @cond *//*==  CONFIGURATION ERRORS  ==*/
+/** @endcond *//** @} *//** @} *//*********************************************
+ * END of rbtree.c
+ ******************************************************************************/
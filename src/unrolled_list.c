@@ -0,0 +1,281 @@
+/*
+ * This file is part of eSolid.
+ *
+ * Copyright (C) 2010 - 2013 Nenad Radulovic
+ *
+ * eSolid is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * eSolid is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with eSolid.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * web site:    http://github.com/nradulovic
+ * e-mail  :    nenad.b.radulovic@gmail.com
+ *//***********************************************************************//**
+ * @file
+ * @author      Nenad Radulovic
+ * @brief       Unrolled linked list implementation
+ * @addtogroup  base_unrolled_list
+ *********************************************************************//** @{ */
+/**@defgroup    base_unrolled_list_impl Implementation
+ * @brief       Unrolled linked list Implementation
+ * @{ *//*--------------------------------------------------------------------*/
+
+/*=========================================================  INCLUDE FILES  ==*/
+
+#include <stddef.h>
+#include <string.h>
+
+#include "base/base.h"
+#include "base/unrolled_list.h"
+
+/*=========================================================  LOCAL MACRO's  ==*/
+
+/**@brief       Unrolled list signature
+ */
+#define ULL_SIGNATURE                   ((esAtomic)0xdeedbef7ul)
+
+/**@brief       Node with less items than this takes items from the next node
+ */
+#define ULL_NODE_HALF                   (ES_ULL_NODE_ITEMS / 2u)
+
+/*======================================================  LOCAL DATA TYPES  ==*/
+/*=============================================  LOCAL FUNCTION PROTOTYPES  ==*/
+
+/**@brief       Allocate an empty node and link it after the given node
+ * @return      Pointer to new node
+ *  @retval     NULL - there is not enough memory
+ */
+static struct esUllNode * nodeAlloc(
+    struct esUll *      ull,
+    struct esDls *      prev);
+
+static void nodeFree(
+    struct esUll *      ull,
+    struct esUllNode *  node);
+
+/**@brief       Refill or merge a node which got less than half full
+ */
+static void nodeRebalance(
+    struct esUll *      ull,
+    struct esUllNode *  node);
+
+/*=======================================================  LOCAL VARIABLES  ==*/
+
+static const ES_MODULE_INFO_CREATE("Unrolled list", "Unrolled linked list", "Nenad Radulovic");
+
+/*======================================================  GLOBAL VARIABLES  ==*/
+/*============================================  LOCAL FUNCTION DEFINITIONS  ==*/
+
+static struct esUllNode * nodeAlloc(
+    struct esUll *      ull,
+    struct esDls *      prev) {
+
+    struct esUllNode *  node;
+
+    node = esAllocatorAlloc(ull->allocator, sizeof(struct esUllNode));
+
+    if (node != NULL) {
+        node->count = 0u;
+        esDlsNodeAddAfter(
+            prev,
+            &node->list);
+    }
+
+    return (node);
+}
+
+static void nodeFree(
+    struct esUll *      ull,
+    struct esUllNode *  node) {
+
+    esDlsNodeRm(
+        &node->list);
+    esAllocatorFree(ull->allocator, node, sizeof(struct esUllNode));
+}
+
+/* 1)       When both nodes fit into one, the next node is merged. Otherwise
+ *          the next node has more than half of items, so moving one item
+ *          leaves it at least half full.
+ */
+static void nodeRebalance(
+    struct esUll *      ull,
+    struct esUllNode *  node) {
+
+    struct esUllNode *  next;
+
+    if ((node->count >= ULL_NODE_HALF) || (node->list.next == &ull->nodes)) {
+
+        return;
+    }
+    next = ES_DLS_NODE_ENTRY(struct esUllNode, list, node->list.next);
+
+    if ((node->count + next->count) <= ES_ULL_NODE_ITEMS) {                     /* See note 1.                                              */
+        memcpy(&node->item[node->count], &next->item[0], next->count * sizeof(void *));
+        node->count += next->count;
+        nodeFree(ull, next);
+    } else {
+        node->item[node->count] = next->item[0];
+        node->count++;
+        next->count--;
+        memmove(&next->item[0], &next->item[1], next->count * sizeof(void *));
+    }
+}
+
+/*===================================  GLOBAL PRIVATE FUNCTION DEFINITIONS  ==*/
+/*====================================  GLOBAL PUBLIC FUNCTION DEFINITIONS  ==*/
+
+void esUllInit(
+    struct esUll *      ull,
+    const struct esAllocator * allocator) {
+
+    ES_REQUIRE(ES_API_POINTER, ull != NULL);
+    ES_REQUIRE(ES_API_OBJECT,  ull->signature != ULL_SIGNATURE);
+    ES_REQUIRE(ES_API_POINTER, allocator != NULL);
+
+    esDlsSentinelInit(
+        &ull->nodes);
+    ull->count     = 0u;
+    ull->allocator = allocator;
+    ES_OBLIGATION(ull->signature = ULL_SIGNATURE);
+}
+
+void esUllTerm(
+    struct esUll *      ull) {
+
+    ES_REQUIRE(ES_API_POINTER, ull != NULL);
+    ES_REQUIRE(ES_API_OBJECT,  ull->signature == ULL_SIGNATURE);
+
+    while (esDlsIsEmpty(&ull->nodes) == false) {
+        nodeFree(ull, ES_DLS_NODE_ENTRY(struct esUllNode, list, ull->nodes.next));
+    }
+    ull->count     = 0u;
+    ull->allocator = NULL;
+    ES_OBLIGATION(ull->signature = ~ULL_SIGNATURE);
+}
+
+esError esUllPushBack(
+    struct esUll *      ull,
+    void *              item) {
+
+    struct esUllNode *  node;
+
+    ES_REQUIRE(ES_API_POINTER, ull != NULL);
+    ES_REQUIRE(ES_API_OBJECT,  ull->signature == ULL_SIGNATURE);
+
+    node = ES_DLS_NODE_ENTRY(struct esUllNode, list, ull->nodes.prev);
+
+    if ((esDlsIsEmpty(&ull->nodes) == true) || (node->count == ES_ULL_NODE_ITEMS)) {
+        node = nodeAlloc(ull, ull->nodes.prev);
+
+        if (node == NULL) {
+
+            return (ES_ERROR_NO_MEMORY);
+        }
+    }
+    node->item[node->count] = item;
+    node->count++;
+    ull->count++;
+
+    return (ES_ERROR_NONE);
+}
+
+/* 1)       A full node is split in two halves. The upper half goes to a new
+ *          node and the position follows its item.
+ */
+esError esUllInsert(
+    struct esUll *      ull,
+    struct esUllIter *  iter,
+    void *              item) {
+
+    struct esUllNode *  node;
+    struct esUllNode *  half;
+    esError             error;
+
+    ES_REQUIRE(ES_API_POINTER, ull != NULL);
+    ES_REQUIRE(ES_API_OBJECT,  ull->signature == ULL_SIGNATURE);
+    ES_REQUIRE(ES_API_POINTER, iter != NULL);
+
+    if (iter->node == &ull->nodes) {
+        error = esUllPushBack(ull, item);
+
+        if (error == ES_ERROR_NONE) {
+            iter->node  = ull->nodes.prev;
+            iter->index = ES_DLS_NODE_ENTRY(struct esUllNode, list, iter->node)->count - 1u;
+        }
+
+        return (error);
+    }
+    node = ES_DLS_NODE_ENTRY(struct esUllNode, list, iter->node);
+
+    if (node->count == ES_ULL_NODE_ITEMS) {                                     /* See note 1.                                              */
+        half = nodeAlloc(ull, &node->list);
+
+        if (half == NULL) {
+
+            return (ES_ERROR_NO_MEMORY);
+        }
+        half->count = node->count - ULL_NODE_HALF;
+        node->count = ULL_NODE_HALF;
+        memcpy(&half->item[0], &node->item[ULL_NODE_HALF], half->count * sizeof(void *));
+
+        if (iter->index > ULL_NODE_HALF) {
+            node         = half;
+            iter->node   = &half->list;
+            iter->index -= ULL_NODE_HALF;
+        }
+    }
+    memmove(&node->item[iter->index + 1u], &node->item[iter->index], (node->count - iter->index) * sizeof(void *));
+    node->item[iter->index] = item;
+    node->count++;
+    ull->count++;
+
+    return (ES_ERROR_NONE);
+}
+
+/* 1)       After rebalancing the item which followed the removed item is still
+ *          at the same index in this node, unless the removed item was the
+ *          last one in the node.
+ */
+void esUllRemove(
+    struct esUll *      ull,
+    struct esUllIter *  iter) {
+
+    struct esUllNode *  node;
+
+    ES_REQUIRE(ES_API_POINTER, ull != NULL);
+    ES_REQUIRE(ES_API_OBJECT,  ull->signature == ULL_SIGNATURE);
+    ES_REQUIRE(ES_API_POINTER, iter != NULL);
+    ES_REQUIRE(ES_API_USAGE,   iter->node != &ull->nodes);
+
+    node = ES_DLS_NODE_ENTRY(struct esUllNode, list, iter->node);
+    node->count--;
+    ull->count--;
+    memmove(&node->item[iter->index], &node->item[iter->index + 1u], (node->count - iter->index) * sizeof(void *));
+
+    if (node->count == 0u) {
+        iter->node  = node->list.next;
+        iter->index = 0u;
+        nodeFree(ull, node);
+
+        return;
+    }
+    nodeRebalance(ull, node);
+
+    if (iter->index == node->count) {                                           /* See note 1.                                              */
+        iter->node  = node->list.next;
+        iter->index = 0u;
+    }
+}
+
+/*================================*//** @cond *//*==  CONFIGURATION ERRORS  ==*/
+/** @endcond *//** @} *//** @} *//*********************************************
+ * END of unrolled_list.c
+ ******************************************************************************/